@@ -0,0 +1,62 @@
+#include <atomic>
+#include <cstddef>                                                                  // size_t
+#include <cstdlib>                                                                  // malloc(), free()
+#include <new>                                                                      // bad_alloc, get_new_handler()
+
+#include "AllocationCounter.hpp"
+
+
+
+
+#if defined( GROCERY_COUNT_ALLOCATIONS )
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  constinit std::atomic<std::size_t> allocations = 0;                               // usable before, and during, static initialization
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Replacement allocation functions
+*******************************************************************************/
+
+// Replacing these is the only portable way to see every allocation the standard containers make.  The array, nothrow, and sized
+// forms all forward to them, and the added cost is one relaxed increment per allocation - which is why only builds that ask for
+// the count replace them.  They're kept in a file of their own so the compiler never sees a use of new alongside these definitions and
+// mistakes the free() below for a mismatched deallocation.
+void * operator new( std::size_t size )
+{
+  allocations.fetch_add( 1, std::memory_order_relaxed );
+
+  // As the standard operator new does, give the installed new handler a chance to free some memory before giving up
+  for( ;; )
+  {
+    if( auto memory = std::malloc( size == 0 ? 1 : size ) )   return memory;
+
+    auto handler = std::get_new_handler();
+    if( handler == nullptr )   throw std::bad_alloc();
+    handler();
+  }
+}
+
+void operator delete( void * memory              ) noexcept { std::free( memory ); }
+void operator delete( void * memory, std::size_t ) noexcept { std::free( memory ); }
+
+
+
+// allocationCount()
+std::size_t allocationCount() noexcept
+{
+  return allocations.load( std::memory_order_relaxed );
+}
+
+#endif    // GROCERY_COUNT_ALLOCATIONS
@@ -0,0 +1,21 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+
+
+
+
+// Allocation counting for the benchmarks' allocations per operation.
+//
+// Built with -DGROCERY_COUNT_ALLOCATIONS, the program's global operator new is replaced (see AllocationCounter.cpp) with one that
+// counts as it allocates.  Take the difference of two readings around the code of interest.  The count costs one relaxed increment
+// per allocation and is independent of GROCERY_INSTRUMENTATION, so a benchmark build can count allocations without compiling in
+// the hot-path probes, and time and allocations come from the same binary.  Otherwise nothing is replaced, so a shipping build pays
+// nothing per allocation, and every reading is zero.
+#if defined( GROCERY_COUNT_ALLOCATIONS )
+  constexpr bool allocationsCounted = true;
+  std::size_t allocationCount() noexcept;                                                     // operator new calls so far, all threads
+#else
+  constexpr bool allocationsCounted = false;
+  constexpr std::size_t allocationCount() noexcept { return 0; }
+#endif
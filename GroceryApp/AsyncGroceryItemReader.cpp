@@ -0,0 +1,213 @@
+#include <algorithm>                                                                // find(), max()
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint32_t
+#include <exception>                                                                // current_exception(), rethrow_exception()
+#include <iostream>
+#include <span>
+#include <thread>
+#include <utility>                                                                  // exchange()
+#include <vector>
+
+#include "AsyncGroceryItemReader.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryItemCursor.hpp"                                                    // GroceryItemParser
+
+
+
+
+/*******************************************************************************
+**  Constructors and destructor
+*******************************************************************************/
+
+// Constructor
+AsyncGroceryItemReader::AsyncGroceryItemReader( std::istream & stream, std::size_t batchSize, std::size_t chunkSize )
+  : _stream   ( stream                                ),
+    _batchSize( std::max<std::size_t>( batchSize, 1 ) )
+{
+  for( std::uint32_t i = 0; i < CHUNKS; ++i )
+  {
+    _chunks[i].bytes.resize( std::max<std::size_t>( chunkSize, 1 ) );
+    _emptyChunks.push( i );
+  }
+
+  for( std::uint32_t i = 0; i < BATCHES; ++i )
+  {
+    _batches[i].groceryItems.resize( _batchSize );
+    _spentBatches.push( i );
+  }
+
+  // Start the threads only once every buffer is in place
+  _reader = std::thread( &AsyncGroceryItemReader::readChunks,  this );
+  _parser = std::thread( &AsyncGroceryItemReader::parseChunks, this );
+}
+
+
+
+// Destructor
+AsyncGroceryItemReader::~AsyncGroceryItemReader() noexcept
+{
+  // Closing every ring releases whichever side is blocked, and each thread then finds its input or output closed and returns
+  _emptyChunks  .close();
+  _filledChunks .close();
+  _spentBatches .close();
+  _parsedBatches.close();
+
+  if( _reader.joinable() )   _reader.join();
+  if( _parser.joinable() )   _parser.join();
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Accessors
+*******************************************************************************/
+
+// next()
+std::span<GroceryItem const> AsyncGroceryItemReader::next()
+{
+  // Hand the batch the caller is done with back to the parser
+  if( _currentBatch != NONE )   _spentBatches.push( std::exchange( _currentBatch, NONE ) );
+
+  auto index = _parsedBatches.pop();
+  if( !index )
+  {
+    // Both threads have finished (or are about to), so joining is quick and makes their error reports safe to read
+    if( _reader.joinable() )   _reader.join();
+    if( _parser.joinable() )   _parser.join();
+
+    if( _parserError )   std::rethrow_exception( std::exchange( _parserError, nullptr ) );
+    if( _readerError )   std::rethrow_exception( std::exchange( _readerError, nullptr ) );
+    return {};
+  }
+
+  _currentBatch = *index;
+  auto & batch  = _batches[_currentBatch];
+  _itemsRead   += batch.count;
+  return { batch.groceryItems.data(), batch.count };
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Private member functions
+*******************************************************************************/
+
+// readChunks()
+void AsyncGroceryItemReader::readChunks()
+{
+  try
+  {
+    for( auto index = _emptyChunks.pop();  index;  index = _emptyChunks.pop() )
+    {
+      auto & chunk = _chunks[*index];
+      _stream.read( chunk.bytes.data(), static_cast<std::streamsize>( chunk.bytes.size() ) );
+      chunk.size = static_cast<std::size_t>( _stream.gcount() );
+      chunk.last = !_stream;                                                        // end of file (or a read error), either way there's no more
+
+      if( !_filledChunks.push( *index )  ||  chunk.last )   break;
+    }
+  }
+  catch( ... )
+  {
+    _readerError = std::current_exception();
+  }
+
+  _filledChunks.close();
+}
+
+
+
+// parseChunks()
+void AsyncGroceryItemReader::parseChunks()
+{
+  using Status = GroceryItemParser::Status;
+
+  try
+  {
+    GroceryItemParser parser;
+    std::vector<char> carry;                                                        // a record cut off at the end of the previous chunk
+    std::uint32_t     batchIndex = NONE;
+
+    // Parses one record into the next free slot of the current batch, sending the batch on when full.  If the caller has gone away
+    // there's no batch to parse into, which is reported as the end of input.
+    auto parseRecord = [&]( char const * first, char const * last, bool endOfInput ) -> GroceryItemParser::Result
+    {
+      if( batchIndex == NONE )
+      {
+        auto index = _spentBatches.pop();
+        if( !index )   return { Status::END_OF_INPUT, first };
+
+        batchIndex                 = *index;
+        _batches[batchIndex].count = 0;
+      }
+
+      auto & batch  = _batches[batchIndex];
+      auto   result = parser.parse( first, last, endOfInput, batch.groceryItems[batch.count] );
+
+      if( result.status == Status::PARSED  &&  ++batch.count == _batchSize )
+      {
+        if( !_parsedBatches.push( batchIndex ) )   return { Status::END_OF_INPUT, first };
+        batchIndex = NONE;
+      }
+      return result;
+    };
+
+
+    bool done = false;
+    while( !done )
+    {
+      auto chunkIndex = _filledChunks.pop();
+      if( !chunkIndex )   break;                                                    // the reader failed, or this reader is being destroyed
+
+      auto const & chunk    = _chunks[*chunkIndex];
+      char const * position = chunk.bytes.data();
+      char const * end      = position + chunk.size;
+
+      // Finish a carried over record first, extending it a line at a time so only the record's own bytes are copied.  Whatever the
+      // parser didn't need is still in this chunk, so parsing resumes there in place.
+      while( !done  &&  !carry.empty() )
+      {
+        auto cut = std::find( position, end, '\n' );
+        if( cut != end )   ++cut;
+        carry.insert( carry.end(), position, cut );
+        position = cut;
+
+        auto result = parseRecord( carry.data(), carry.data() + carry.size(), chunk.last  &&  position == end );
+        if     ( result.status == Status::PARSED     ) { position -= carry.data() + carry.size() - result.next;  carry.clear(); }
+        else if( result.status == Status::INCOMPLETE ) { if( position == end )   break; }
+        else                                           { done = true;  _malformed = result.status == Status::MALFORMED; }
+      }
+
+      while( !done  &&  carry.empty() )
+      {
+        auto result = parseRecord( position, end, chunk.last );
+        if     ( result.status == Status::PARSED     )   position = result.next;
+        else if( result.status == Status::INCOMPLETE ) { carry.assign( position, end );  break; }
+        else                                           { done = true;  _malformed = result.status == Status::MALFORMED; }
+      }
+
+      done = done  ||  chunk.last;
+      _emptyChunks.push( *chunkIndex );
+    }
+
+    if( batchIndex != NONE  &&  _batches[batchIndex].count > 0 )   _parsedBatches.push( batchIndex );
+  }
+  catch( ... )
+  {
+    _parserError = std::current_exception();
+  }
+
+  // The reader may be waiting for a chunk that will never come back, and the caller for a batch that will never come
+  _emptyChunks  .close();
+  _parsedBatches.close();
+}
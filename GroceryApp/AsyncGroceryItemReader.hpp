@@ -0,0 +1,90 @@
+#pragma once                                                                                  // include guard
+
+#include <array>
+#include <atomic>
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint32_t
+#include <exception>                                                                          // exception_ptr
+#include <iostream>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "SpscRing.hpp"
+
+
+
+
+// Reads the GroceryItem text format on background threads so that waiting on input and parsing overlap, and hands parsed grocery
+// items to the caller in batches.
+//
+// A reader thread fills two chunk buffers in turn (double buffering) while a parser thread runs GroceryItemParser over the chunk
+// filled before, so load time approaches the larger of I/O time and parse time rather than their sum.  Parsed grocery items go
+// into a small pool of reusable batches passed to the caller through a bounded single producer single consumer ring, and come back
+// to the parser when the caller asks for the next batch.  Memory is therefore constant:  two chunks plus a few batches.
+//
+// The stream belongs to the reader thread until next() reports the end of input or this object is destroyed.  As with operator>>,
+// reading stops at the first malformed record.  An exception thrown on either thread is rethrown to the caller by next().
+class AsyncGroceryItemReader
+{
+  public:
+    explicit AsyncGroceryItemReader( std::istream & stream, std::size_t batchSize = 4'096, std::size_t chunkSize = 256 * 1024 );
+
+    AsyncGroceryItemReader            ( AsyncGroceryItemReader const & ) = delete;           // owns running threads referring to this object
+    AsyncGroceryItemReader & operator=( AsyncGroceryItemReader const & ) = delete;
+   ~AsyncGroceryItemReader            (                                ) noexcept;           // stops both threads, even mid-stream
+
+
+    // Queries
+    std::size_t itemsRead() const noexcept { return _itemsRead; }                            // total across all batches so far
+    bool        malformed() const noexcept { return _malformed.load(); }                     // true if reading stopped at a malformed record rather than the end of input
+
+
+    // Accessors
+    std::span<GroceryItem const> next();                                                      // blocks for the next batch, empty once input is exhausted.  Valid until the next call.
+
+
+  private:
+    static constexpr std::size_t   CHUNKS  = 2;                                               // one being read while the other is parsed
+    static constexpr std::size_t   BATCHES = 4;                                               // lets the parser run a little ahead of the caller
+    static constexpr std::uint32_t NONE    = static_cast<std::uint32_t>( -1 );
+
+    struct Chunk
+    {
+      std::vector<char> bytes;
+      std::size_t       size = 0;                                                             // bytes actually read
+      bool              last = false;                                                         // no input follows this chunk
+    };
+
+    struct Batch
+    {
+      std::vector<GroceryItem> groceryItems;                                                  // reused from batch to batch, count valid
+      std::size_t              count = 0;
+    };
+
+    // Instance Attributes
+    std::istream &                      _stream;
+    std::size_t                         _batchSize;
+    std::array<Chunk, CHUNKS>           _chunks;
+    std::array<Batch, BATCHES>          _batches;
+
+    SpscRing<std::uint32_t, CHUNKS>     _filledChunks;                                        // reader thread -> parser thread
+    SpscRing<std::uint32_t, CHUNKS>     _emptyChunks;                                         // parser thread -> reader thread
+    SpscRing<std::uint32_t, BATCHES>    _parsedBatches;                                       // parser thread -> caller
+    SpscRing<std::uint32_t, BATCHES>    _spentBatches;                                        // caller        -> parser thread
+
+    std::uint32_t                       _currentBatch = NONE;                                 // the batch the caller is looking at
+    std::size_t                         _itemsRead    = 0;
+    std::atomic<bool>                   _malformed    = false;
+    std::exception_ptr                  _readerError;                                         // each written by its own thread before closing its output ring
+    std::exception_ptr                  _parserError;
+
+    std::thread                         _reader;                                              // started at the end of the constructor, once every buffer is in place
+    std::thread                         _parser;
+
+
+    // Helper member functions
+    void readChunks ();                                                                       // reader thread
+    void parseChunks();                                                                       // parser thread
+};
@@ -0,0 +1,115 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <sstream>
+#include <string>                                                         // to_string()
+#include <vector>
+
+#include "AsyncGroceryItemReader.hpp"
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryItemCursor.hpp"
+
+
+
+namespace    // anonymous
+{
+  class AsyncGroceryItemReaderRegressionTest
+  {
+    public:
+      AsyncGroceryItemReaderRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_async_grocery_item_reader_tests;
+
+
+
+
+  // Reads everything through the reader, copying each batch out before asking for the next
+  template<typename Reader>
+  std::vector<GroceryItem> readAll( Reader & reader )
+  {
+    std::vector<GroceryItem> result;
+    for( auto batch = reader.next();  !batch.empty();  batch = reader.next() )   result.insert( result.end(), batch.begin(), batch.end() );
+    return result;
+  }
+
+
+
+
+  void AsyncGroceryItemReaderRegressionTest::test()
+  {
+    std::vector<GroceryItem> written;
+    std::ostringstream       out;
+    for( unsigned i = 0; i < 20'000; ++i )
+    {
+      written.push_back( { "product \\ " + std::to_string( i ), "brand \"" + std::to_string( i % 17 ) + '"', std::to_string( 100'000 + i ), i * 0.25 } );
+      out << written.back() << ( i % 3 == 0 ? "\n" : "  " );
+    }
+    auto const text = out.str();
+
+    {
+      std::istringstream     feed( text );
+      AsyncGroceryItemReader reader( feed, 100, 4'096 );
+      affirm.is_true ( "Async:  Large feed round trips", readAll( reader ) == written  &&  !reader.malformed() );
+      affirm.is_equal( "Async:  Items read",             written.size(), reader.itemsRead() );
+      affirm.is_true ( "Async:  Stays at end",           reader.next().empty() );
+    }
+
+    {
+      // Chunks far smaller than a record carry every record across several chunks
+      std::istringstream     feed( text.substr( 0, 2'000 ) ), reference( text.substr( 0, 2'000 ) );
+      AsyncGroceryItemReader reader( feed, 3, 5 );
+      GroceryItemCursor      cursor( reference );
+      affirm.is_true ( "Async:  Tiny chunks match the cursor", readAll( reader ) == readAll( cursor ) );
+    }
+
+    {
+      std::istringstream     feed( "\"1\", \"A\", \"a\", 1.00\n"
+                                   "\"2\", \"B\", \"b\", 2.00\n"
+                                   "\"3\", \"C\"  \"c\", 3.00\n"
+                                   "\"4\", \"D\", \"d\", 4.00\n" );
+      AsyncGroceryItemReader reader( feed );
+      affirm.is_equal( "Malformed:  Stops before the bad record", 2U, readAll( reader ).size() );
+      affirm.is_true ( "Malformed:  Reported",                   reader.malformed() );
+    }
+
+    {
+      // Abandoning a reader mid-stream must stop both threads rather than leave them blocked
+      std::istringstream feed( text );
+      bool               stopped = false;
+      {
+        AsyncGroceryItemReader reader( feed, 16, 1'024 );
+        stopped = reader.next().size() == 16;
+      }
+      affirm.is_true( "Async:  Destroyed mid-stream", stopped );
+    }
+  }
+
+
+
+
+  AsyncGroceryItemReaderRegressionTest::AsyncGroceryItemReaderRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nAsyncGroceryItemReader Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nAsyncGroceryItemReader Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class AsyncGroceryItemReader\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
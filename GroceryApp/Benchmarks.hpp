@@ -0,0 +1,32 @@
+#pragma once                                                                                  // include guard
+
+#include <chrono>                                                                              // steady_clock
+#include <cstddef>                                                                             // size_t
+#include <iostream>
+#include <utility>                                                                             // forward()
+
+
+
+
+// Benchmarks are run on request (see main's --benchmark option), never as part of the regression tests
+void fixedGroceryListBenchmark( std::ostream & stream );                                      // FixedGroceryList<N> vs GroceryList for N = 8, 16, and 64
+void groceryBenchmark         ( std::ostream & stream, std::size_t maxSize = 10'000'000 );    // GroceryItem and GroceryList operations, GroceryItem at sizes 10 through maxSize
+
+
+
+
+// Helpers shared by the benchmarks
+namespace Benchmark
+{
+  inline volatile std::size_t sink = 0;                                                       // results land here so the work can't be optimized away
+
+  // Wall clock nanoseconds taken by one call of operation()
+  template<typename Operation>
+  double nanosecondsFor( Operation && operation )
+  {
+    auto const start = std::chrono::steady_clock::now();
+    std::forward<Operation>( operation )();
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+  }
+}    // namespace Benchmark
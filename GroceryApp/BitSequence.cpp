@@ -0,0 +1,129 @@
+#include <bit>                                                                      // popcount(), countr_zero()
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint64_t
+#include <vector>
+
+#include "BitSequence.hpp"
+
+
+
+
+/*******************************************************************************
+**  Queries
+*******************************************************************************/
+
+// test() const
+bool BitSequence::test( std::size_t offset ) const noexcept
+{
+  return ( _words[offset / WORD_BITS] >> ( offset % WORD_BITS ) ) & 1;
+}
+
+
+
+// count() const
+std::size_t BitSequence::count( bool value ) const noexcept
+{
+  // A straight reduction over whole words with no branches, which the compiler is free to vectorize
+  std::size_t ones = 0;
+  for( auto word : _words )   ones += static_cast<std::size_t>( std::popcount( word ) );
+
+  return value  ?  ones  :  _size - ones;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Accessors
+*******************************************************************************/
+
+// offsets() const
+std::vector<std::size_t> BitSequence::offsets( bool value ) const
+{
+  std::vector<std::size_t> result;
+  result.reserve( count( value ) );
+
+  // Skip whole words with nothing to report, and within a word jump straight from one wanted bit to the next
+  for( std::size_t w = 0; w < _words.size(); ++w )
+  {
+    auto bits = value  ?  _words[w]  :  ~_words[w];
+    if( !value  &&  w == _words.size() - 1  &&  _size % WORD_BITS != 0 )   bits &= ( std::uint64_t{ 1 } << ( _size % WORD_BITS ) ) - 1;   // clear bits beyond size()
+
+    for( ;  bits != 0;  bits &= bits - 1 )   result.push_back( w * WORD_BITS + static_cast<std::size_t>( std::countr_zero( bits ) ) );
+  }
+  return result;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Modifiers
+*******************************************************************************/
+
+// set()
+void BitSequence::set( std::size_t offset, bool value ) noexcept
+{
+  auto const mask = std::uint64_t{ 1 } << ( offset % WORD_BITS );
+  auto &     word = _words[offset / WORD_BITS];
+
+  word = value  ?  word | mask  :  word & ~mask;
+}
+
+
+
+// insert()
+void BitSequence::insert( std::size_t offset, bool value )
+{
+  if( _size % WORD_BITS == 0 )   _words.push_back( 0 );
+
+  // Words above the one holding offset move up one bit whole, each taking the top bit of the word below
+  auto const first = offset / WORD_BITS;
+  for( auto w = _words.size() - 1;  w > first;  --w )   _words[w] = ( _words[w] << 1 ) | ( _words[w - 1] >> ( WORD_BITS - 1 ) );
+
+  // Within the word holding offset, only the bits at and above offset move
+  auto const below = ( std::uint64_t{ 1 } << ( offset % WORD_BITS ) ) - 1;
+  auto &     word  = _words[first];
+  word = ( word & below )  |  ( ( word & ~below ) << 1 )  |  ( std::uint64_t{ value } << ( offset % WORD_BITS ) );
+
+  ++_size;
+}
+
+
+
+// erase()
+void BitSequence::erase( std::size_t offset ) noexcept
+{
+  auto const first = offset / WORD_BITS;
+  auto const last  = _words.size() - 1;
+
+  // Within the word holding offset the bits above offset move down over it, and the word above lends its bottom bit
+  auto const below = ( std::uint64_t{ 1 } << ( offset % WORD_BITS ) ) - 1;
+  auto &     word  = _words[first];
+  word = ( word & below )  |  ( ( word >> 1 ) & ~below );
+
+  for( auto w = first;  w < last;  ++w )
+  {
+    _words[w]     |= _words[w + 1] << ( WORD_BITS - 1 );
+    _words[w + 1] >>= 1;
+  }
+
+  if( --_size % WORD_BITS == 0 )   _words.pop_back();                              // the last word is now empty
+}
+
+
+
+// clear()
+void BitSequence::clear() noexcept
+{
+  _words.clear();
+  _size = 0;
+}
@@ -0,0 +1,41 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint64_t
+#include <vector>
+
+
+
+
+// A dynamically sized sequence of bits, packed 64 to a word, that supports inserting and erasing at any offset.
+//
+// It's the bitwise counterpart of a std::vector<bool> kept parallel to some other sequence:  insert() and erase() shift the bits
+// above the offset by one position, a whole word at a time, so a sequence of n bits is shifted in n/64 steps rather than n.  Bits
+// beyond size() are always zero, which lets count() and offsets() work word by word without masking all but the last word.
+class BitSequence
+{
+  public:
+    // Queries
+    std::size_t size ()                    const noexcept { return _size; }
+    bool        test ( std::size_t offset ) const noexcept;                                  // offset must be less than size()
+    std::size_t count( bool value = true  ) const noexcept;                                  // number of bits equal to value
+
+
+    // Accessors
+    std::vector<std::size_t> offsets( bool value = true ) const;                              // ascending offsets of the bits equal to value
+
+
+    // Modifiers
+    void set   ( std::size_t offset, bool value = true  ) noexcept;                          // offset must be less than size()
+    void insert( std::size_t offset, bool value = false );                                    // offset may equal size(), bits at and above offset move up one
+    void erase ( std::size_t offset                     ) noexcept;                          // offset must be less than size(), bits above offset move down one
+    void clear (                                        ) noexcept;
+
+
+  private:
+    static constexpr std::size_t WORD_BITS = 64;
+
+    // Instance Attributes
+    std::vector<std::uint64_t> _words;                                                        // bit i is bit (i % 64) of word (i / 64)
+    std::size_t                _size = 0;
+};
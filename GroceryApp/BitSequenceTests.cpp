@@ -0,0 +1,141 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <random>
+#include <vector>
+
+#include "BitSequence.hpp"
+#include "CheckResults.hpp"
+
+
+
+namespace    // anonymous
+{
+  class BitSequenceRegressionTest
+  {
+    public:
+      BitSequenceRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_bit_sequence_tests;
+
+
+
+
+  // Does the bit sequence hold exactly the reference's bits, and answer every query the same way?
+  bool matches( BitSequence const & bits, std::vector<bool> const & reference )
+  {
+    if( bits.size() != reference.size() )   return false;
+
+    std::vector<std::size_t> ones, zeros;
+    for( std::size_t i = 0; i < reference.size(); ++i )
+    {
+      if( bits.test( i ) != reference[i] )   return false;
+      ( reference[i] ? ones : zeros ).push_back( i );
+    }
+
+    return bits.count( true  ) == ones .size()  &&  bits.offsets( true  ) == ones
+       &&  bits.count( false ) == zeros.size()  &&  bits.offsets( false ) == zeros;
+  }
+
+
+
+
+  void BitSequenceRegressionTest::test()
+  {
+    {
+      BitSequence bits;
+      affirm.is_true( "Empty", bits.size() == 0  &&  bits.count() == 0  &&  bits.offsets( false ).empty() );
+    }
+
+    {
+      // Fill exactly one word, then push a set bit across the word boundary from the front
+      BitSequence       bits;
+      std::vector<bool> reference;
+      for( std::size_t i = 0; i < 64; ++i )   { bits.insert( i, i % 3 == 0 );  reference.push_back( i % 3 == 0 ); }
+
+      bits.insert( 0, true );
+      reference.insert( reference.begin(), true );
+      affirm.is_true( "Insert carries across words", matches( bits, reference )  &&  bits.test( 64 ) );
+
+      bits.erase( 0 );
+      reference.erase( reference.begin() );
+      affirm.is_true( "Erase carries back and shrinks", matches( bits, reference )  &&  bits.count() == 22 );
+    }
+
+    {
+      BitSequence bits;
+      for( std::size_t i = 0; i < 130; ++i )   bits.insert( i );
+      bits.set( 129 );
+      bits.set( 64  );
+      bits.set( 64, false );
+      affirm.is_true( "Set and clear", bits.offsets() == std::vector<std::size_t>{ 129 }  &&  bits.count( false ) == 129 );
+
+      bits.clear();
+      affirm.is_true( "Clear", bits.size() == 0  &&  bits.count() == 0 );
+    }
+
+    {
+      // Random inserts, erases, and sets over a few hundred bits, checked against std::vector<bool> after every step
+      std::mt19937      generator( 323 );
+      BitSequence       bits;
+      std::vector<bool> reference;
+      bool              agree = true;
+
+      for( unsigned step = 0; step < 4'000  &&  agree; ++step )
+      {
+        auto action = generator() % 8;
+        if( reference.empty()  ||  ( action < 4  &&  reference.size() < 400 ) )
+        {
+          std::size_t offset = generator() % ( reference.size() + 1 );
+          bool        value  = generator() % 2 == 0;
+          bits.insert( offset, value );
+          reference.insert( reference.begin() + static_cast<std::ptrdiff_t>( offset ), value );
+        }
+        else if( action < 7 )
+        {
+          std::size_t offset = generator() % reference.size();
+          bits.erase( offset );
+          reference.erase( reference.begin() + static_cast<std::ptrdiff_t>( offset ) );
+        }
+        else
+        {
+          std::size_t offset = generator() % reference.size();
+          bits.set( offset, !reference[offset] );
+          reference[offset] = !reference[offset];
+        }
+
+        agree = matches( bits, reference );
+      }
+
+      affirm.is_true( "Random operations match std::vector<bool>", agree );
+    }
+  }
+
+
+
+
+  BitSequenceRegressionTest::BitSequenceRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nBitSequence Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nBitSequence Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class BitSequence\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,60 @@
+#include <algorithm>                                                                // max()
+#include <cstddef>                                                                  // size_t
+#include <numeric>                                                                  // accumulate(), iota()
+#include <span>
+#include <vector>
+
+#include "BudgetOptimizer.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+
+/*******************************************************************************
+**  Public member functions
+*******************************************************************************/
+
+// optimize() const
+GroceryList BudgetOptimizer::optimize( GroceryList const & groceryList, double budget ) const
+{
+  std::vector<Cents> prices;
+  prices.reserve( groceryList.size() );
+  for( auto && groceryItem : groceryList )   prices.push_back( PriceCatalog::toCents( groceryItem.price() ) );
+
+  GroceryList result;
+  auto        items = groceryList.begin();
+  for( auto offset : choose( prices, PriceCatalog::toCents( budget ) ) )   result.insert( items[static_cast<std::ptrdiff_t>( offset )], GroceryList::Position::BOTTOM );
+
+  return result;
+}
+
+
+
+// choose() const
+std::vector<std::size_t> BudgetOptimizer::choose( std::span<Cents const> prices, Cents budget ) const
+{
+  auto const count = prices.size();
+  if( count == 0  ||  budget < 0 )   return {};
+
+  // Early exit:  if everything is affordable, take everything
+  if( std::accumulate( prices.begin(), prices.end(), Cents{ 0 } ) <= budget )
+  {
+    std::vector<std::size_t> all( count );
+    std::iota( all.begin(), all.end(), std::size_t{ 0 } );
+    return all;
+  }
+
+  // An item outranks everything below it combined, so taking it whenever it still fits can never be beaten by leaving it out to
+  // make room for lower items.  Walking top down therefore visits the offsets in ascending order, too.
+  std::vector<std::size_t> chosen;
+  for( std::size_t offset = 0; offset < count; ++offset )
+  {
+    if( prices[offset] > budget )   continue;
+    budget -= std::max<Cents>( prices[offset], 0 );
+    chosen.push_back( offset );
+  }
+
+  return chosen;
+}
@@ -0,0 +1,27 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <span>
+#include <vector>
+
+#include "GroceryList.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+
+// Chooses the most valuable affordable subset of a grocery list.
+//
+// Position implies priority, and priority is strict:  each grocery item outranks every item below it combined, as if the item at
+// offset i of n were worth 2^(n-1-i).  So the best affordable subset is the lexicographically greatest one - keep the top item if it
+// fits, then the next if it still fits, and so on down the list.  That makes the 0/1 knapsack over prices in fixed-point cents
+// exact in a single top-down pass, with no table to bound, which is fast enough to re-run interactively on long lists.  If
+// everything fits the budget, no search happens at all.
+class BudgetOptimizer
+{
+  public:
+    using Cents = PriceCatalog::Cents;
+
+    GroceryList              optimize( GroceryList const & groceryList, double budget ) const;  // returns the chosen grocery items in their original order
+    std::vector<std::size_t> choose  ( std::span<Cents const> prices,   Cents  budget ) const;  // returns chosen offsets (ascending), prices listed top to bottom
+};
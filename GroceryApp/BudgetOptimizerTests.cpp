@@ -0,0 +1,105 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <random>                                                         // mt19937, uniform_int_distribution
+#include <vector>
+
+#include "BudgetOptimizer.hpp"
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+namespace    // anonymous
+{
+  class BudgetOptimizerRegressionTest
+  {
+    public:
+      BudgetOptimizerRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_budget_optimizer_tests;
+
+
+
+
+  void BudgetOptimizerRegressionTest::test()
+  {
+    BudgetOptimizer optimizer;
+
+    {
+      GroceryList list = { { "eggs",   "", "", 3.00 },
+                           { "milk",   "", "", 4.00 },
+                           { "bread",  "", "", 2.50 },
+                           { "steak",  "", "", 9.00 } };
+
+      affirm.is_equal( "Everything affordable",  list, optimizer.optimize( list, 20.00 ) );
+
+      // Each item outranks all below it.  With $9.50 eggs, milk, and bread all still fit as the list is walked, and steak doesn't
+      affirm.is_equal( "Best affordable subset", GroceryList{ { "eggs", "", "", 3.00 }, { "milk", "", "", 4.00 }, { "bread", "", "", 2.50 } }, optimizer.optimize( list, 9.50 ) );
+
+      // $7.00 buys eggs+milk rather than eggs+bread
+      affirm.is_equal( "Exact budget",           GroceryList{ { "eggs", "", "", 3.00 }, { "milk", "", "", 4.00 } }, optimizer.optimize( list, 7.00 ) );
+      affirm.is_equal( "Nothing affordable",     GroceryList{}, optimizer.optimize( list, 1.00 ) );
+    }
+
+    {
+      // The top item alone outranks the three below it combined, even though together they'd use the whole budget too
+      GroceryList list = { { "turkey",   "", "", 5.00 },
+                           { "stuffing", "", "", 1.00 },
+                           { "gravy",    "", "", 1.00 },
+                           { "rolls",    "", "", 1.00 } };
+
+      affirm.is_equal( "Top item outranks all below it", GroceryList{ { "turkey", "", "", 5.00 } }, optimizer.optimize( list, 5.00 ) );
+    }
+
+    {
+      // 10k items, chosen in one pass.  Within budget, and nothing skipped would have fit once the items above it were bought.
+      std::mt19937                                       generator( 42 );
+      std::uniform_int_distribution<BudgetOptimizer::Cents> price( 1, 5'000 );
+      std::vector<BudgetOptimizer::Cents>                prices( 10'000 );
+      for( auto & p : prices )   p = price( generator );
+
+      BudgetOptimizer::Cents budget = 250'000;
+      auto                   chosen = optimizer.choose( prices, budget );
+
+      BudgetOptimizer::Cents remaining = budget;
+      bool                   maximal   = true;
+      for( std::size_t offset = 0, next = 0; offset < prices.size(); ++offset )
+      {
+        if( next < chosen.size()  &&  chosen[next] == offset ) { remaining -= prices[offset];  ++next; }
+        else if( prices[offset] <= remaining )                 maximal = false;
+      }
+      affirm.is_true( "Large list stays within budget", remaining >= 0  &&  !chosen.empty() );
+      affirm.is_true( "Large list skips only what no longer fits", maximal );
+    }
+  }
+
+
+
+
+  BudgetOptimizerRegressionTest::BudgetOptimizerRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nBudgetOptimizer Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nBudgetOptimizer Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class BudgetOptimizer\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,194 @@
+#include <algorithm>                                                                // max()
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint32_t
+#include <iomanip>                                                                  // setw(), left(), right()
+#include <iostream>
+#include <iterator>                                                                 // distance()
+#include <span>
+#include <string>                                                                   // to_string()
+#include <vector>
+
+#include "Checkout.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // Formats fixed-point cents as dollars and cents, e.g. 1234 -> "$12.34", -5 -> "-$0.05".  The text is built whole before it's
+  // inserted, so a field width set on the stream pads the entire amount rather than just its sign.
+  struct Money
+  {
+    PriceCatalog::Cents cents;
+
+    std::string str() const
+    {
+      auto magnitude = cents < 0 ? -cents : cents;
+
+      std::string text = cents < 0 ? "-$" : "$";
+      text += std::to_string( magnitude / 100 );
+      text += '.';
+      text += static_cast<char>( '0' + magnitude % 100 / 10 );
+      text += static_cast<char>( '0' + magnitude %  10      );
+      return text;
+    }
+
+    friend std::ostream & operator<<( std::ostream & stream, Money money )
+    { return stream << money.str(); }
+  };
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Receipt
+*******************************************************************************/
+
+// operator<<
+std::ostream & operator<<( std::ostream & stream, Receipt const & receipt )
+{
+  for( auto && line : receipt.lines )
+  {
+    stream << '\n' << std::left  << std::setw( 16 ) << line.groceryItem->upcCode()
+                                 << std::setw( 60 ) << line.groceryItem->productName()
+                   << std::right << std::setw( 10 ) << Money{ line.unitPrice };
+    if( line.discount  != 0 )   stream << "  (" << Money{ -line.discount } << ')';
+    if( !line.inCatalog     )   stream << "  (not in catalog)";
+  }
+
+  return stream << "\n\n" << std::left  << std::setw( 76 ) << "Subtotal"  << std::right << std::setw( 10 ) << Money{  receipt.subtotal  }
+                << '\n'   << std::left  << std::setw( 76 ) << "Discounts" << std::right << std::setw( 10 ) << Money{ -receipt.discounts }
+                << '\n'   << std::left  << std::setw( 76 ) << "Total"     << std::right << std::setw( 10 ) << Money{  receipt.total     };
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  CheckoutEngine
+*******************************************************************************/
+
+// Constructor
+CheckoutEngine::CheckoutEngine( PriceCatalog const & catalog )
+  : _catalog( catalog )
+{
+  _items     .reserve( BATCH_ITEMS );
+  _baskets   .reserve( BATCH_ITEMS );
+  _hashes    .reserve( BATCH_ITEMS );
+  _entries   .reserve( BATCH_ITEMS );
+  _unitPrices.reserve( BATCH_ITEMS );
+  _discounts .reserve( BATCH_ITEMS );
+}
+
+
+
+// checkout( basket )
+Receipt CheckoutEngine::checkout( GroceryList const & basket )
+{
+  Receipt receipt;
+  runBatch( { &basket, 1 }, &receipt );
+  return receipt;
+}
+
+
+
+// checkout( baskets )
+std::vector<Receipt> CheckoutEngine::checkout( std::span<GroceryList const> baskets )
+{
+  std::vector<Receipt> receipts( baskets.size() );
+
+  // Group consecutive baskets until the batch holds about BATCH_ITEMS grocery items.  A basket bigger than that is a batch of its own.
+  std::size_t first = 0, itemCount = 0;
+  for( std::size_t next = 0; next < baskets.size(); ++next )
+  {
+    itemCount += static_cast<std::size_t>( std::distance( baskets[next].begin(), baskets[next].end() ) );   // size() would audit the basket
+    if( itemCount >= BATCH_ITEMS )
+    {
+      runBatch( baskets.subspan( first, next + 1 - first ), receipts.data() + first );
+      first     = next + 1;
+      itemCount = 0;
+    }
+  }
+  if( first < baskets.size() )   runBatch( baskets.subspan( first ), receipts.data() + first );
+
+  return receipts;
+}
+
+
+
+// runBatch()
+void CheckoutEngine::runBatch( std::span<GroceryList const> baskets, Receipt * receipts )
+{
+  // Stage 1 - Gather the batch's grocery items into contiguous columns
+  _items  .clear();
+  _baskets.clear();
+  for( std::size_t basket = 0; basket < baskets.size(); ++basket )
+  {
+    for( auto && groceryItem : baskets[basket] )
+    {
+      _items  .push_back( &groceryItem );
+      _baskets.push_back( static_cast<std::uint32_t>( basket ) );
+    }
+  }
+
+  auto const count = _items.size();
+  _hashes    .resize( count );
+  _entries   .resize( count );
+  _unitPrices.resize( count );
+  _discounts .resize( count );
+
+
+  // Stage 2 - Hash every UPC code, then look them all up.  Keeping these apart lets the hashing loop run without waiting on memory.
+  for( std::size_t i = 0; i < count; ++i )   _hashes [i] = PriceCatalog::hash( _items[i]->upcCode() );
+  for( std::size_t i = 0; i < count; ++i )   _entries[i] = _catalog.find( _items[i]->upcCode(), _hashes[i] );
+
+
+  // Stage 3 - Resolve unit prices, falling back to the grocery item's own price when it isn't in the catalog
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    _unitPrices[i] = _entries[i] != PriceCatalog::NOT_FOUND  ?  _catalog.price( _entries[i] )
+                                                             :  PriceCatalog::toCents( _items[i]->price() );
+  }
+
+
+  // Stage 4 - Apply promotions, the better of the item and brand promotion wins
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    if( _entries[i] == PriceCatalog::NOT_FOUND ) { _discounts[i] = 0;  continue; }
+
+    _discounts[i] = std::max( _catalog.itemPromotion ( _entries[i] ).discountOn( _unitPrices[i] ),
+                              _catalog.brandPromotion( _entries[i] ).discountOn( _unitPrices[i] ) );
+  }
+
+
+  // Stage 5 - Emit receipt lines and accumulate each basket's totals
+  for( std::size_t basket = 0; basket < baskets.size(); ++basket )
+  {
+    receipts[basket].lines.reserve( static_cast<std::size_t>( std::distance( baskets[basket].begin(), baskets[basket].end() ) ) );
+  }
+
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    auto & receipt = receipts[_baskets[i]];
+    receipt.lines.push_back( { _items[i], _unitPrices[i], _discounts[i], _entries[i] != PriceCatalog::NOT_FOUND } );
+    receipt.subtotal  += _unitPrices[i];
+    receipt.discounts += _discounts [i];
+  }
+
+  for( std::size_t basket = 0; basket < baskets.size(); ++basket )   receipts[basket].total = receipts[basket].subtotal - receipts[basket].discounts;
+}
@@ -0,0 +1,74 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint32_t, uint64_t
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+
+// The priced result of checking out one basket (a grocery list).  Lines refer to the basket's grocery items, so a receipt must not
+// outlive the basket it was produced from.
+struct Receipt
+{
+  using Cents = PriceCatalog::Cents;
+
+  struct Line
+  {
+    GroceryItem const * groceryItem = nullptr;
+    Cents               unitPrice   = 0;
+    Cents               discount    = 0;
+    bool                inCatalog   = false;                                                  // false if priced from the grocery item itself
+  };
+
+  std::vector<Line> lines;
+  Cents             subtotal  = 0;                                                            // sum of unit prices
+  Cents             discounts = 0;                                                            // sum of promotion discounts
+  Cents             total     = 0;                                                            // subtotal - discounts
+};
+
+std::ostream & operator<<( std::ostream & stream, Receipt const & receipt );
+
+
+
+
+// Prices baskets against a catalog and applies per-item and per-brand promotions.
+//
+// Baskets are processed in batches.  The grocery items of a batch of baskets are gathered into contiguous columns, and each stage -
+// hash the UPC codes, look them up in the catalog, apply promotions, then total per basket - runs as one tight loop over the whole
+// batch before the next stage starts.  The columns are reused from batch to batch, so after warm up the only allocations are the
+// receipts themselves.
+//
+// When an item has both an item and a brand promotion, the larger discount applies (promotions don't stack).  Items whose UPC code
+// isn't in the catalog are charged the grocery item's own price with no promotion.
+class CheckoutEngine
+{
+  public:
+    explicit CheckoutEngine( PriceCatalog const & catalog );
+
+    Receipt              checkout( GroceryList const & basket );
+    std::vector<Receipt> checkout( std::span<GroceryList const> baskets );
+
+  private:
+    static constexpr std::size_t BATCH_ITEMS = 1024;                                          // keeps each column comfortably within L1/L2 cache
+
+    // Instance Attributes
+    PriceCatalog const & _catalog;
+
+    std::vector<GroceryItem const *>    _items;                                               // per item columns for the current batch
+    std::vector<std::uint32_t>          _baskets;                                             // batch relative basket number of each item
+    std::vector<std::uint64_t>          _hashes;
+    std::vector<PriceCatalog::EntryID>  _entries;
+    std::vector<PriceCatalog::Cents>    _unitPrices;
+    std::vector<PriceCatalog::Cents>    _discounts;
+
+
+    // Helper member functions
+    void runBatch( std::span<GroceryList const> baskets, Receipt * receipts );
+};
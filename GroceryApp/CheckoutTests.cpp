@@ -0,0 +1,125 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <sstream>                                                        // ostringstream
+#include <string>                                                         // to_string()
+#include <utility>                                                        // move()
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "Checkout.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+namespace    // anonymous
+{
+  class CheckoutRegressionTest
+  {
+    public:
+      CheckoutRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_checkout_tests;
+
+
+
+
+  void CheckoutRegressionTest::test()
+  {
+    using Kind = PriceCatalog::Promotion::Kind;
+
+    PriceCatalog catalog = { { "cereal",   "Brand A", "001", 4.00 },
+                             { "granola",  "Brand A", "002", 3.00 },
+                             { "milk",     "Brand B", "003", 2.50 },
+                             { "eggs",     "Brand C", "004", 1.99 } };
+
+    {
+      affirm.is_equal( "Catalog:  Size",              4U,    catalog.size() );
+      affirm.is_equal( "Catalog:  Price by UPC",      250LL, static_cast<long long>( catalog.price( catalog.find( "003" ) ) ) );
+      affirm.is_true ( "Catalog:  Missing UPC",       catalog.find( "999" ) == PriceCatalog::NOT_FOUND );
+
+      catalog.add( { "eggs", "Brand C", "004", 2.09 } );
+      affirm.is_equal( "Catalog:  Re-adding replaces", 209LL, static_cast<long long>( catalog.price( catalog.find( "004" ) ) ) );
+      affirm.is_equal( "Catalog:  Re-adding keeps size", 4U,  catalog.size() );
+    }
+
+    catalog.addItemPromotion ( "001",     { Kind::AMOUNT_OFF,  25    } );                 // 25 cents off cereal
+    catalog.addBrandPromotion( "Brand A", { Kind::PERCENT_OFF, 1'000 } );                 // 10% off Brand A (40 cents on cereal, 30 on granola)
+    catalog.addItemPromotion ( "003",     { Kind::AMOUNT_OFF,  999   } );                 // more than the price, capped at the price
+
+    CheckoutEngine engine( catalog );
+
+    {
+      GroceryList basket = { { "cereal",  "Brand A", "001" },
+                             { "granola", "Brand A", "002" },
+                             { "milk",    "Brand B", "003" },
+                             { "apples",  "",        "",     1.10 } };
+
+      auto receipt = engine.checkout( basket );
+      affirm.is_equal( "Checkout:  Lines",                        4U,     receipt.lines.size() );
+      affirm.is_equal( "Checkout:  Larger of item/brand promotion", 40LL, static_cast<long long>( receipt.lines[0].discount ) );
+      affirm.is_equal( "Checkout:  Brand promotion",                30LL, static_cast<long long>( receipt.lines[1].discount ) );
+      affirm.is_equal( "Checkout:  Discount capped at price",      250LL, static_cast<long long>( receipt.lines[2].discount ) );
+      affirm.is_true ( "Checkout:  Unknown UPC uses item price",   !receipt.lines[3].inCatalog && receipt.lines[3].unitPrice == 110 );
+      affirm.is_equal( "Checkout:  Subtotal",                     1060LL, static_cast<long long>( receipt.subtotal ) );
+      affirm.is_equal( "Checkout:  Total",                          740LL, static_cast<long long>( receipt.total    ) );
+
+      std::ostringstream printed;
+      printed << receipt;
+      auto text      = printed.str();
+      auto totalLine = text.substr( text.rfind( '\n' ) + 1 );
+      affirm.is_equal( "Receipt:  Amounts right aligned", std::string( 76, ' ' ).replace( 0, 5, "Total" ) + "     $7.40", totalLine );
+    }
+
+    {
+      // Many baskets spanning several batches must price exactly as if each were checked out alone
+      std::vector<GroceryList> baskets;
+      for( unsigned i = 0; i < 1'000; ++i )
+      {
+        GroceryList basket;
+        for( unsigned j = 0; j <= i % 9; ++j )   basket.insert( { "item " + std::to_string( j ), "", "00" + std::to_string( 1 + ( i + j ) % 5 ), 0.5 }, GroceryList::Position::BOTTOM );
+        baskets.push_back( std::move( basket ) );
+      }
+
+      auto receipts = engine.checkout( baskets );
+
+      bool allMatch = receipts.size() == baskets.size();
+      for( std::size_t i = 0; allMatch && i < baskets.size(); ++i )
+      {
+        auto alone = engine.checkout( baskets[i] );
+        allMatch   = alone.total == receipts[i].total  &&  alone.lines.size() == receipts[i].lines.size();
+      }
+      affirm.is_true( "Batched checkout matches single checkout", allMatch );
+    }
+  }
+
+
+
+
+  CheckoutRegressionTest::CheckoutRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nCheckout Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nCheckout Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class CheckoutEngine\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
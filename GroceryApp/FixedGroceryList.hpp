@@ -0,0 +1,284 @@
+#pragma once                                                                                  // include guard
+
+#include <algorithm>                                                                          // move(), move_backward()
+#include <array>
+#include <compare>                                                                            // compare_three_way, compare_three_way_result_t
+#include <concepts>                                                                           // same_as
+#include <cstddef>                                                                            // size_t
+#include <initializer_list>
+#include <utility>                                                                            // index_sequence, make_index_sequence
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+// A grocery list whose maximum length N is known at compile time.
+//
+// Grocery items are stored inline in a std::array, so the list itself never allocates, copies are a flat copy of at most N items,
+// and there's a single container to keep in order rather than GroceryList's five.  find() is expanded at compile time into N
+// straight-line comparisons (no loop), and insert() and remove() shift elements within the fixed array.  Every operation is
+// constexpr, so with a literal item type (GroceryItem isn't one) a whole list can be built and queried at compile time.
+//
+// Behavior mirrors GroceryList:  duplicates are silently ignored, offsets are zero-based from the top, find() returns size() when
+// not found, and the same exceptions are thrown.  For GroceryItem lists, conversion to and from GroceryList and += in either
+// direction let fixed and dynamic lists be mixed freely.
+template<std::size_t N, typename Item = GroceryItem>
+class FixedGroceryList
+{
+  public:
+    // Types and Exceptions
+    using Position                = GroceryList::Position;
+    using CapacityExceeded_Ex     = GroceryList::CapacityExceeded_Ex;                         // Thrown if more grocery items are inserted than will fit
+    using InvalidOffset_Ex        = GroceryList::InvalidOffset_Ex;                            // Thrown if inserting beyond current size
+
+
+    // Constructors
+    constexpr FixedGroceryList() = default;
+    constexpr FixedGroceryList( std::initializer_list<Item> const & initList );
+
+    explicit  FixedGroceryList( GroceryList const & groceryList ) requires std::same_as<Item, GroceryItem>;
+              operator GroceryList()                      const   requires std::same_as<Item, GroceryItem>;
+
+
+    // Queries
+    static constexpr std::size_t capacity()       noexcept { return N;     }
+           constexpr std::size_t size    () const noexcept { return _size; }
+
+
+    // Accessors
+    constexpr std::size_t  find( Item const & item ) const;                                  // returns the item's (zero-based) offset from top, size() if not found
+
+    constexpr Item const * begin() const noexcept { return _items.data();         }
+    constexpr Item const * end  () const noexcept { return _items.data() + _size; }
+
+
+    // Modifiers
+    constexpr void insert   ( Item const & item, Position    position = Position::TOP );     // inserts the item at the top (beginning) or bottom (end) of the list
+    constexpr void insert   ( Item const & item, std::size_t offsetFromTop            );     // inserts before the existing item currently at that offset
+
+    constexpr void remove   ( Item const & item                                       );     // no change occurs if item not found
+    constexpr void remove   ( std::size_t  offsetFromTop                              );     // no change occurs if (zero-based) offsetFromTop >= size()
+
+    constexpr void moveToTop( Item const & item                                       );     // finds then moves item from its current position to the top of the list
+
+    constexpr FixedGroceryList & operator+=( std::initializer_list<Item> const & rhs );      // appends each item to the bottom of this list
+    template<std::size_t M>
+    constexpr FixedGroceryList & operator+=( FixedGroceryList<M, Item>   const & rhs );
+              FixedGroceryList & operator+=( GroceryList                 const & rhs ) requires std::same_as<Item, GroceryItem>;
+
+
+    // Relational Operators
+    constexpr std::compare_three_way_result_t<Item>
+                   operator<=>( FixedGroceryList const & rhs ) const;
+    constexpr bool operator== ( FixedGroceryList const & rhs ) const;
+
+
+  private:
+    // Instance Attributes
+    std::array<Item, N> _items = {};                                                          // [0, _size) are in the list, the rest are default constructed
+    std::size_t         _size  = 0;
+
+
+    // Helper member functions
+    template<std::size_t... Offset>
+    constexpr std::size_t findUnrolled( Item const & item, std::index_sequence<Offset...> ) const;
+};
+
+
+
+
+// Lets a dynamic grocery list absorb a fixed one
+template<std::size_t N>
+GroceryList & operator+=( GroceryList & lhs, FixedGroceryList<N> const & rhs );
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// Initializer List Constructor
+template<std::size_t N, typename Item>
+constexpr FixedGroceryList<N, Item>::FixedGroceryList( std::initializer_list<Item> const & initList )
+{
+  for( auto && item : initList )   insert( item, Position::BOTTOM );
+}
+
+
+
+// Conversion from GroceryList
+template<std::size_t N, typename Item>
+FixedGroceryList<N, Item>::FixedGroceryList( GroceryList const & groceryList ) requires std::same_as<Item, GroceryItem>
+{
+  *this += groceryList;
+}
+
+
+
+// Conversion to GroceryList
+template<std::size_t N, typename Item>
+FixedGroceryList<N, Item>::operator GroceryList() const requires std::same_as<Item, GroceryItem>
+{
+  GroceryList result;
+  for( auto && item : *this )   result.insert( item, Position::BOTTOM );
+  return result;
+}
+
+
+
+// find() const
+template<std::size_t N, typename Item>
+constexpr std::size_t FixedGroceryList<N, Item>::find( Item const & item ) const
+{
+  return findUnrolled( item, std::make_index_sequence<N>{} );
+}
+
+
+
+// insert( position )
+template<std::size_t N, typename Item>
+constexpr void FixedGroceryList<N, Item>::insert( Item const & item, Position position )
+{
+  insert( item, position == Position::TOP ? 0 : _size );
+}
+
+
+
+// insert( offset )
+template<std::size_t N, typename Item>
+constexpr void FixedGroceryList<N, Item>::insert( Item const & item, std::size_t offsetFromTop )
+{
+  if( offsetFromTop > _size )    throw InvalidOffset_Ex    ( "Insertion position beyond end of current list size" );
+  if( find( item ) != _size )    return;                                                    // silently ignore duplicates
+  if( _size == N )               throw CapacityExceeded_Ex ( "There is no room in the fixed size grocery list for another grocery item" );
+
+  std::move_backward( _items.begin() + offsetFromTop, _items.begin() + _size, _items.begin() + _size + 1 );
+  _items[offsetFromTop] = item;
+  ++_size;
+}
+
+
+
+// remove( item )
+template<std::size_t N, typename Item>
+constexpr void FixedGroceryList<N, Item>::remove( Item const & item )
+{
+  remove( find( item ) );
+}
+
+
+
+// remove( offset )
+template<std::size_t N, typename Item>
+constexpr void FixedGroceryList<N, Item>::remove( std::size_t offsetFromTop )
+{
+  if( offsetFromTop >= _size )   return;
+
+  std::move( _items.begin() + offsetFromTop + 1, _items.begin() + _size, _items.begin() + offsetFromTop );
+  _items[--_size] = Item{};                                                                 // release whatever the vacated slot held
+}
+
+
+
+// moveToTop()
+template<std::size_t N, typename Item>
+constexpr void FixedGroceryList<N, Item>::moveToTop( Item const & item )
+{
+  auto offset = find( item );
+  if( offset == _size  ||  offset == 0 )   return;
+
+  // Rotate [0, offset] right by one rather than remove and re-insert, so nothing is copied twice
+  auto moving = std::move( _items[offset] );
+  std::move_backward( _items.begin(), _items.begin() + offset, _items.begin() + offset + 1 );
+  _items[0] = std::move( moving );
+}
+
+
+
+// operator+=( initializer_list )
+template<std::size_t N, typename Item>
+constexpr FixedGroceryList<N, Item> & FixedGroceryList<N, Item>::operator+=( std::initializer_list<Item> const & rhs )
+{
+  for( auto && item : rhs )   insert( item, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// operator+=( FixedGroceryList )
+template<std::size_t N, typename Item>
+template<std::size_t M>
+constexpr FixedGroceryList<N, Item> & FixedGroceryList<N, Item>::operator+=( FixedGroceryList<M, Item> const & rhs )
+{
+  for( auto && item : rhs )   insert( item, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// operator+=( GroceryList )
+template<std::size_t N, typename Item>
+FixedGroceryList<N, Item> & FixedGroceryList<N, Item>::operator+=( GroceryList const & rhs ) requires std::same_as<Item, GroceryItem>
+{
+  for( auto && item : rhs )   insert( item, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// operator<=>
+template<std::size_t N, typename Item>
+constexpr std::compare_three_way_result_t<Item> FixedGroceryList<N, Item>::operator<=>( FixedGroceryList const & rhs ) const
+{
+  // Compare the common prefix, and if that's equal the shorter list orders first
+  for( std::size_t i = 0; i < _size  &&  i < rhs._size; ++i )
+  {
+    if( auto result = std::compare_three_way{}( _items[i], rhs._items[i] );  result != 0 )   return result;
+  }
+  return _size <=> rhs._size;
+}
+
+
+
+// operator==
+template<std::size_t N, typename Item>
+constexpr bool FixedGroceryList<N, Item>::operator==( FixedGroceryList const & rhs ) const
+{
+  if( _size != rhs._size )   return false;
+
+  for( std::size_t i = 0; i < _size; ++i )
+  {
+    if( !( _items[i] == rhs._items[i] ) )   return false;
+  }
+  return true;
+}
+
+
+
+// findUnrolled() const
+template<std::size_t N, typename Item>
+template<std::size_t... Offset>
+constexpr std::size_t FixedGroceryList<N, Item>::findUnrolled( Item const & item, std::index_sequence<Offset...> ) const
+{
+  // The fold expands to one guarded comparison per slot, stopping at the first match
+  std::size_t result = _size;
+  static_cast<void>( ( ... || ( Offset < _size  &&  _items[Offset] == item  &&  ( result = Offset, true ) ) ) );
+  return result;
+}
+
+
+
+// operator+=( GroceryList, FixedGroceryList )
+template<std::size_t N>
+GroceryList & operator+=( GroceryList & lhs, FixedGroceryList<N> const & rhs )
+{
+  for( auto && item : rhs )   lhs.insert( item, GroceryList::Position::BOTTOM );
+  return lhs;
+}
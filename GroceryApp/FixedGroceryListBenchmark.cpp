@@ -0,0 +1,95 @@
+#include <cstddef>                                                                  // size_t
+#include <iomanip>                                                                  // setw(), setprecision()
+#include <iostream>
+#include <string>                                                                   // to_string()
+#include <vector>
+
+#include "Benchmarks.hpp"
+#include "FixedGroceryList.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  constexpr std::size_t REPETITIONS = 20'000;
+
+  using Benchmark::sink;
+
+
+
+  template<typename Operation>
+  double nanosecondsPer( std::size_t operations, Operation && operation )
+  {
+    auto elapsed = Benchmark::nanosecondsFor( [&] { for( std::size_t i = 0; i < REPETITIONS; ++i )   operation(); } );
+    return elapsed / static_cast<double>( REPETITIONS * operations );
+  }
+
+
+
+  // Times find (every item, once each), a top insert and remove pair, and a copy
+  template<typename List>
+  std::vector<double> measure( std::vector<GroceryItem> const & groceryItems )
+  {
+    List list;
+    for( auto && groceryItem : groceryItems )   list.insert( groceryItem, GroceryList::Position::BOTTOM );
+    GroceryItem const absent{ "not on the list" };
+
+    return { nanosecondsPer( groceryItems.size(), [&] { for( auto && groceryItem : groceryItems )   sink = sink + list.find( groceryItem ); } ),
+             nanosecondsPer( 1,                   [&] { list.insert( absent );  list.remove( std::size_t{ 0 } ); } ),
+             nanosecondsPer( 1,                   [&] { List copy( list );  sink = sink + copy.size(); } ) };
+  }
+
+
+
+  template<std::size_t N>
+  void compare( std::ostream & stream )
+  {
+    // One short of capacity, so the insert and remove pair always has room
+    std::vector<GroceryItem> groceryItems;
+    for( std::size_t i = 0; i + 1 < N; ++i )   groceryItems.push_back( { "product " + std::to_string( i ), "brand", std::to_string( 10'000 + i ) } );
+
+    auto fixed = measure<FixedGroceryList<N>>( groceryItems );
+
+    // GroceryList's fixed size array holds at most 11 grocery items, so it can only be compared at the smallest size
+    bool const dynamicFits = N <= 11;
+    auto       dynamic     = dynamicFits  ?  measure<GroceryList>( groceryItems )  :  std::vector<double>( fixed.size() );
+
+    char const * operations[] = { "find", "insert + remove", "copy" };
+    for( std::size_t i = 0; i < fixed.size(); ++i )
+    {
+      stream << std::setw( 5 ) << N << "  " << std::left << std::setw( 18 ) << operations[i] << std::right << std::setw( 12 ) << fixed[i];
+      if( dynamicFits )   stream << std::setw( 14 ) << dynamic[i] << std::setw( 10 ) << dynamic[i] / fixed[i] << "x\n";
+      else                stream << std::setw( 14 ) << "n/a"      << '\n';
+    }
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Benchmarks
+*******************************************************************************/
+
+// fixedGroceryListBenchmark()
+void fixedGroceryListBenchmark( std::ostream & stream )
+{
+  stream << "\nFixedGroceryList<N> vs GroceryList, nanoseconds per operation (lists hold N-1 grocery items)\n"
+         << std::setw( 5 ) << "N" << "  " << std::left << std::setw( 18 ) << "operation" << std::right
+         << std::setw( 12 ) << "fixed" << std::setw( 14 ) << "dynamic" << std::setw( 11 ) << "speedup" << '\n'
+         << std::fixed << std::setprecision( 1 );
+
+  compare< 8>( stream );
+  compare<16>( stream );
+  compare<64>( stream );
+}
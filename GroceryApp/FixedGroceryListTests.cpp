@@ -0,0 +1,118 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+
+#include "CheckResults.hpp"
+#include "FixedGroceryList.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+namespace    // anonymous
+{
+  class FixedGroceryListRegressionTest
+  {
+    public:
+      FixedGroceryListRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_fixed_grocery_list_tests;
+
+
+
+
+  // Built and edited entirely at compile time
+  constexpr FixedGroceryList<4, int> compileTimeList()
+  {
+    FixedGroceryList<4, int> list = { 1, 2, 3 };
+    list.insert( 0 );                                                     // 0 1 2 3
+    list.insert( 2 );                                                     // duplicate, ignored
+    list.remove( std::size_t{ 2 } );                                      // 0 1 3
+    list.moveToTop( 3 );                                                  // 3 0 1
+    return list;
+  }
+
+  static_assert( compileTimeList().size()    == 3 );
+  static_assert( compileTimeList().find( 3 ) == 0 );
+  static_assert( compileTimeList().find( 2 ) == 3 );
+  static_assert( compileTimeList() == FixedGroceryList<4, int>{ 3, 0, 1 } );
+  static_assert( compileTimeList() <  FixedGroceryList<4, int>{ 3, 1 } );
+
+
+
+
+  void FixedGroceryListRegressionTest::test()
+  {
+    GroceryItem const milk{ "milk" }, eggs{ "eggs" }, bread{ "bread" }, butter{ "butter", "Lakes 'Ole" };
+
+    {
+      FixedGroceryList<4> list = { milk, eggs, bread };
+      affirm.is_equal( "Fixed:  Size",                    3U, list.size() );
+      affirm.is_equal( "Fixed:  Find",                    1U, list.find( eggs ) );
+      affirm.is_equal( "Fixed:  Find - not there",        3U, list.find( butter ) );
+
+      list.insert( butter, list.find( bread ) );
+      list.insert( milk );
+      affirm.is_true ( "Fixed:  Insert before, ignoring duplicates", list == FixedGroceryList<4>{ milk, eggs, butter, bread } );
+
+      try
+      {
+        list.insert( { "apples" } );
+        affirm.is_true( "Fixed:  Capacity exceeded", false );
+      }
+      catch( GroceryList::CapacityExceeded_Ex const & )
+      {
+        affirm.is_true( "Fixed:  Capacity exceeded", true );
+      }
+
+      list.remove( eggs );
+      list.remove( std::size_t{ 99 } );
+      list.moveToTop( bread );
+      affirm.is_true ( "Fixed:  Remove and move to top",  list == FixedGroceryList<4>{ bread, milk, butter } );
+    }
+
+    {
+      FixedGroceryList<8> fixed   = { milk, eggs };
+      GroceryList         dynamic = { bread, milk };
+
+      GroceryList converted = fixed;
+      affirm.is_true ( "Interop:  Convert to GroceryList",   converted == GroceryList{ milk, eggs } );
+      affirm.is_true ( "Interop:  Convert from GroceryList", FixedGroceryList<8>( dynamic ) == FixedGroceryList<8>{ bread, milk } );
+
+      dynamic += fixed;
+      affirm.is_true ( "Interop:  GroceryList += fixed",     dynamic == GroceryList{ bread, milk, eggs } );
+
+      fixed += dynamic;
+      fixed += FixedGroceryList<2>{ butter };
+      affirm.is_true ( "Interop:  fixed += GroceryList and fixed", fixed == FixedGroceryList<8>{ milk, eggs, bread, butter } );
+    }
+  }
+
+
+
+
+  FixedGroceryListRegressionTest::FixedGroceryListRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nFixedGroceryList Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nFixedGroceryList Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class FixedGroceryList\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,213 @@
+#include <algorithm>                                                                // copy(), move(), sort(), min()
+#include <compare>                                                                  // operator<=> results
+#include <cstddef>                                                                  // size_t
+#include <iomanip>                                                                  // setw(), setprecision()
+#include <iostream>
+#include <sstream>
+#include <string>                                                                   // to_string()
+#include <utility>                                                                  // move(), forward()
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "Benchmarks.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryItemCursor.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  constexpr std::size_t MIN_SAMPLES    = 5;
+  constexpr std::size_t MAX_SAMPLES    = 20'000;
+  constexpr double      SAMPLE_BUDGET  = 100e6;                                     // nanoseconds of timed work per measurement, once MIN_SAMPLES are in
+
+  using Benchmark::sink;
+
+
+  struct Result
+  {
+    double nanosecondsPerOperation = 0;                                             // mean over every timed operation
+    double allocationsPerOperation = 0;
+    double p50                     = 0;                                             // percentiles of the per sample nanoseconds per operation
+    double p99                     = 0;
+  };
+
+
+
+  // Times operation() repeatedly, each call a sample of operationsPerCall operations.  prepare() runs untimed before every sample to
+  // put back whatever the operation consumes, and its allocations aren't counted.
+  template<typename Prepare, typename Operation>
+  Result measure( std::size_t operationsPerCall, Prepare && prepare, Operation && operation )
+  {
+    std::vector<double> samples;
+    double              elapsedTotal     = 0;
+    std::size_t         allocationsTotal = 0;
+
+    while( samples.size() < MAX_SAMPLES  &&  ( samples.size() < MIN_SAMPLES  ||  elapsedTotal < SAMPLE_BUDGET ) )
+    {
+      prepare();
+
+      auto const allocationsBefore = allocationCount();
+      auto const elapsed           = Benchmark::nanosecondsFor( operation );
+      allocationsTotal += allocationCount() - allocationsBefore;
+
+      elapsedTotal += elapsed;
+      samples.push_back( elapsed / static_cast<double>( operationsPerCall ) );
+    }
+
+    std::sort( samples.begin(), samples.end() );
+    auto const operations = static_cast<double>( samples.size() * operationsPerCall );
+    return { elapsedTotal                                  / operations,
+             static_cast<double>( allocationsTotal )       / operations,
+             samples[ samples.size()        / 2          ],
+             samples[ samples.size() * 99   / 100        ] };
+  }
+
+  template<typename Operation>
+  Result measure( std::size_t operationsPerCall, Operation && operation )
+  {
+    return measure( operationsPerCall, [] {}, std::forward<Operation>( operation ) );
+  }
+
+
+
+  // One fixed width row per measurement, so runs of different builds can be compared with diff
+  void report( std::ostream & stream, std::string const & group, std::size_t size, std::string const & operation, Result const & result )
+  {
+    stream << std::left  << std::setw( 12 ) << group << std::right << std::setw( 10 ) << size << "  " << std::left << std::setw( 22 ) << operation << std::right
+           << std::setw( 12 ) << result.nanosecondsPerOperation
+           << std::setw( 14 ) << 1e9 / result.nanosecondsPerOperation
+           << std::setw( 10 );
+    if constexpr( allocationsCounted )   stream << result.allocationsPerOperation;             // only builds with GROCERY_COUNT_ALLOCATIONS count them
+    else                                 stream << "n/a";
+    stream << std::setw( 12 ) << result.p50
+           << std::setw( 12 ) << result.p99 << '\n';
+  }
+
+
+
+  // Distinct, reproducible grocery items.  The strings fit the short string buffer, so copying a grocery item needn't allocate.
+  std::vector<GroceryItem> makeGroceryItems( std::size_t count, std::size_t first = 0 )
+  {
+    std::vector<GroceryItem> groceryItems;
+    groceryItems.reserve( count );
+    for( auto i = first; i < first + count; ++i )
+    {
+      auto upc = std::to_string( i );
+      groceryItems.push_back( { "product " + std::to_string( i % 10'000'000 ), "brand " + std::to_string( i % 97 ),
+                                std::string( 14 - std::min<std::size_t>( upc.size(), 14 ), '0' ) + upc, static_cast<double>( i % 1'000 ) / 100.0 + 0.99 } );
+    }
+    return groceryItems;
+  }
+
+
+
+  // GroceryItem operations over n grocery items at a time, so larger sizes show the effect of the caches
+  void groceryItemBenchmarks( std::ostream & stream, std::size_t size )
+  {
+    auto const               groceryItems = makeGroceryItems( size );
+    std::vector<GroceryItem> scratch( size );
+
+    report( stream, "GroceryItem", size, "copy assign", measure( size, [&] { std::copy( groceryItems.begin(), groceryItems.end(), scratch.begin() ); } ) );
+
+    {
+      std::vector<GroceryItem> source;                                              // scoped, so at the larger sizes it's released before the text is printed
+      report( stream, "GroceryItem", size, "move assign", measure( size, [&] { source = groceryItems; },
+                                                                         [&] { std::move( source.begin(), source.end(), scratch.begin() ); } ) );
+    }
+
+    scratch = groceryItems;                                                         // equal but separate, so every comparison runs to the end
+    report( stream, "GroceryItem", size, "operator==",  measure( size, [&] { std::size_t equal = 0;
+                                                                             for( std::size_t i = 0; i < size; ++i )   equal += groceryItems[i] == scratch[i];
+                                                                             sink = sink + equal; } ) );
+    report( stream, "GroceryItem", size, "operator<=>", measure( size, [&] { std::size_t same = 0;
+                                                                             for( std::size_t i = 0; i < size; ++i )   same += ( groceryItems[i] <=> scratch[i] ) == 0;
+                                                                             sink = sink + same; } ) );
+
+    std::ostringstream printed;
+    report( stream, "GroceryItem", size, "operator<<", measure( size, [&] { printed.str( {} ); },
+                                                                      [&] { for( auto && groceryItem : groceryItems )   printed << groceryItem << '\n'; } ) );
+    auto const text = printed.str();
+    printed.str( {} );                                                              // one copy of the text is plenty at the larger sizes
+
+    std::istringstream parsing;
+    report( stream, "GroceryItem", size, "operator>>", measure( size, [&] { parsing.clear();  parsing.str( text ); },
+                                                                      [&] { std::size_t i = 0;
+                                                                            while( i < size  &&  parsing >> scratch[i] )   ++i;
+                                                                            sink = sink + i; } ) );
+
+    report( stream, "GroceryItem", size, "GroceryItemCursor", measure( size, [&] { parsing.clear();  parsing.str( text ); },
+                                                                             [&] { GroceryItemCursor cursor( parsing );
+                                                                                   while( !cursor.next().empty() ) {}
+                                                                                   sink = sink + cursor.itemsRead(); } ) );
+  }
+
+
+
+  // Every public GroceryList operation on a list of the given size
+  void groceryListBenchmarks( std::ostream & stream, std::size_t size )
+  {
+    auto const groceryItems = makeGroceryItems( size );
+    auto const newcomer     = makeGroceryItems( 1, size ).front();
+
+    GroceryList list;
+    for( auto && groceryItem : groceryItems )   list.insert( groceryItem, GroceryList::Position::BOTTOM );
+    GroceryList const other( list );
+    GroceryList       work;
+
+    report( stream, "GroceryList", size, "construct",    measure( 1,    [&] { GroceryList built;
+                                                                               for( auto && groceryItem : groceryItems )   built.insert( groceryItem, GroceryList::Position::BOTTOM );
+                                                                               sink = sink + built.size(); } ) );
+    report( stream, "GroceryList", size, "copy",         measure( 1,    [&] { GroceryList copy( list );  sink = sink + copy.size(); } ) );
+    report( stream, "GroceryList", size, "move",         measure( 1,    [&] { work = list; },
+                                                                        [&] { GroceryList moved( std::move( work ) );  sink = sink + moved.size(); } ) );
+    report( stream, "GroceryList", size, "operator==",   measure( 1,    [&] { sink = sink + ( list == other ); } ) );
+    report( stream, "GroceryList", size, "operator<=>",  measure( 1,    [&] { sink = sink + ( ( list <=> other ) == 0 ); } ) );
+    report( stream, "GroceryList", size, "find",         measure( size, [&] { for( auto && groceryItem : groceryItems )   sink = sink + list.find( groceryItem ); } ) );
+
+    report( stream, "GroceryList", size, "insert top",    measure( 1,   [&] { work = list; }, [&] { work.insert( newcomer, GroceryList::Position::TOP    ); } ) );
+    report( stream, "GroceryList", size, "insert middle", measure( 1,   [&] { work = list; }, [&] { work.insert( newcomer, size / 2                      ); } ) );
+    report( stream, "GroceryList", size, "insert bottom", measure( 1,   [&] { work = list; }, [&] { work.insert( newcomer, GroceryList::Position::BOTTOM ); } ) );
+    report( stream, "GroceryList", size, "remove",        measure( 1,   [&] { work = list; }, [&] { work.remove( size / 2 ); } ) );
+    report( stream, "GroceryList", size, "moveToTop",     measure( 1,   [&] { work = list; }, [&] { work.moveToTop( groceryItems.back() ); } ) );
+    report( stream, "GroceryList", size, "operator+=",    measure( size, [&] { work = GroceryList{}; }, [&] { work += list; } ) );
+
+    std::ostringstream printed;
+    report( stream, "GroceryList", size, "operator<<",    measure( size, [&] { printed.str( {} ); }, [&] { printed << list; } ) );
+
+    std::istringstream parsing;
+    std::string const  text = [&] { std::ostringstream out;  for( auto && groceryItem : groceryItems )   out << groceryItem << '\n';  return out.str(); }();
+    report( stream, "GroceryList", size, "operator>>",    measure( size, [&] { parsing.clear();  parsing.str( text );  work = GroceryList{}; },
+                                                                         [&] { parsing >> work; } ) );
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Benchmarks
+*******************************************************************************/
+
+// groceryBenchmark()
+void groceryBenchmark( std::ostream & stream, std::size_t maxSize )
+{
+  stream << "\nGroceryItem and GroceryList microbenchmarks.  Times are nanoseconds per operation, p50 and p99 over samples.\n"
+         << std::left  << std::setw( 12 ) << "group" << std::right << std::setw( 10 ) << "size" << "  " << std::left << std::setw( 22 ) << "operation" << std::right
+         << std::setw( 12 ) << "ns/op" << std::setw( 14 ) << "ops/sec" << std::setw( 10 ) << "allocs/op" << std::setw( 12 ) << "p50" << std::setw( 12 ) << "p99" << '\n'
+         << std::fixed << std::setprecision( 1 );
+
+  // GroceryList's fixed size array holds at most 11 grocery items, so its operations are measured at the smallest size only
+  groceryListBenchmarks( stream, 10 );
+
+  for( std::size_t size = 10; size <= maxSize; size *= 10 )   groceryItemBenchmarks( stream, size );
+}
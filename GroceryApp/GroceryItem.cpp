@@ -7,6 +7,7 @@
 #include <utility>                                                    // move()
 
 #include "GroceryItem.hpp"
+#include "Instrumentation.hpp"
 
 
 
@@ -53,7 +54,7 @@ GroceryItem::GroceryItem( GroceryItem const & other )
 :_productName(other._productName),
 _brandName(other._brandName),
 _upcCode(other._upcCode),
-_price(other._price){}
+_price(other._price){ INSTRUMENT_COUNT( ITEM_COPY, 1 ); }
 
 
 
@@ -63,7 +64,7 @@ GroceryItem::GroceryItem( GroceryItem && other ) noexcept
 :_productName(std::move(other._productName)),
 _brandName(std::move(other._brandName)),
 _upcCode(std::move(other._upcCode)),
-_price(std::move(other._price)){}
+_price(std::move(other._price)){ INSTRUMENT_COUNT( ITEM_MOVE, 1 ); }
 
 
 
@@ -71,6 +72,8 @@ _price(std::move(other._price)){}
 // Copy Assignment Operator
 GroceryItem & GroceryItem::operator=( GroceryItem const & rhs ) &
 {
+  INSTRUMENT_COUNT( ITEM_COPY, 1 );
+
   this->_productName = rhs._productName;
   this->_brandName = rhs._brandName;
   this->_upcCode = rhs._upcCode;
@@ -85,6 +88,8 @@ GroceryItem & GroceryItem::operator=( GroceryItem const & rhs ) &
 // Move Assignment Operator
 GroceryItem & GroceryItem::operator=( GroceryItem && rhs ) & noexcept
 {
+  INSTRUMENT_COUNT( ITEM_MOVE, 1 );
+
   this->_productName = std::move(rhs._productName);
   this->_brandName = std::move(rhs._brandName);
   this->_upcCode = std::move(rhs._upcCode);  
@@ -232,6 +237,7 @@ return *this;
 // operator<=>
 std::weak_ordering GroceryItem::operator<=>( const GroceryItem & rhs ) const noexcept
 {
+  INSTRUMENT_SCOPE( ITEM_COMPARE );
   
   // Grocery items are equal if all attributes are equal (or within Epsilon for floating point numbers, like price). Grocery items are ordered
   // (sorted) by UPC code, product name, brand name, then price.
@@ -252,6 +258,8 @@ std::weak_ordering GroceryItem::operator<=>( const GroceryItem & rhs ) const noe
 // operator==
 bool GroceryItem::operator==( const GroceryItem & rhs ) const noexcept
 {
+  INSTRUMENT_SCOPE( ITEM_EQUAL );
+
   // All attributes must be equal for the two grocery items to be equal to the other.  This can be done in any order, so put the
   // quickest and then the most likely to be different first.
 
@@ -0,0 +1,222 @@
+#include <algorithm>                                                                // copy(), count(), find(), max(), min()
+#include <cctype>                                                                   // isspace()
+#include <charconv>                                                                 // from_chars()
+#include <cstddef>                                                                  // size_t
+#include <iostream>
+#include <span>
+#include <string>
+#include <system_error>                                                             // errc
+#include <utility>                                                                  // move()
+
+#include "GroceryItem.hpp"
+#include "GroceryItemCursor.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  char const * skipSpace( char const * first, char const * last ) noexcept
+  {
+    while( first != last  &&  std::isspace( static_cast<unsigned char>( *first ) ) )   ++first;
+    return first;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  GroceryItemParser
+*******************************************************************************/
+
+// parse()
+GroceryItemParser::Result GroceryItemParser::parse( char const * first, char const * last, bool endOfInput, GroceryItem & groceryItem )
+{
+  // Running out of input mid-record means "come back with more" unless there is no more
+  auto outOfInput = [&]( char const * where, char const * reason )
+  {
+    return endOfInput  ?  Result{ Status::MALFORMED, where, reason }  :  Result{ Status::INCOMPLETE, first };
+  };
+
+  auto cursor = skipSpace( first, last );
+  if( cursor == last )   return { endOfInput ? Status::END_OF_INPUT : Status::INCOMPLETE, first };
+
+
+  // UPC code, brand name, and product name:  quoted strings, each followed by a comma
+  for( auto field : { &_upcCode, &_brandName, &_productName } )
+  {
+    cursor = skipSpace( cursor, last );
+    if( cursor == last )   return outOfInput( cursor, "expected a quoted field" );
+    if( *cursor != '"' )   return { Status::MALFORMED, cursor, "expected a quoted field" };
+
+    field->clear();
+    for( ++cursor;; )
+    {
+      // Copy runs of ordinary characters at once, stopping only for the closing quote or an escape
+      auto run = cursor;
+      while( run != last  &&  *run != '"'  &&  *run != '\\' )   ++run;
+      field->append( cursor, run );
+      cursor = run;
+
+      if( cursor == last )   return outOfInput( cursor, "unterminated quoted field" );
+      if( *cursor == '"' ) { ++cursor;  break; }
+
+      if( ++cursor == last )   return outOfInput( cursor, "unterminated quoted field" );
+      field->push_back( *cursor++ );
+    }
+
+    cursor = skipSpace( cursor, last );
+    if( cursor == last )   return outOfInput( cursor, "expected ',' after a quoted field" );
+    if( *cursor != ',' )   return { Status::MALFORMED, cursor, "expected ',' after a quoted field" };
+    ++cursor;
+  }
+
+
+  // Price:  the whole token must be a number.  A token reaching the end of the buffer may continue in the next chunk.
+  cursor = skipSpace( cursor, last );
+  auto tokenEnd = cursor;
+  while( tokenEnd != last  &&  *tokenEnd != '"'  &&  *tokenEnd != ','  &&  !std::isspace( static_cast<unsigned char>( *tokenEnd ) ) )   ++tokenEnd;
+
+  if( tokenEnd == last  &&  !endOfInput )   return { Status::INCOMPLETE, first };
+
+  double price  = 0.0;
+  auto   number = cursor != tokenEnd  &&  *cursor == '+'  ?  cursor + 1  :  cursor;
+  auto [numberEnd, error] = std::from_chars( number, tokenEnd, price );
+  if( cursor == tokenEnd  ||  error != std::errc{}  ||  numberEnd != tokenEnd )   return { Status::MALFORMED, cursor, "expected a price" };
+
+
+  // Swap the parsed strings into the grocery item, keeping the item's old strings (and their capacity) as the next parse's buffers
+  auto oldUpcCode     = std::move( groceryItem ).upcCode    ();   groceryItem.upcCode    ( std::move( _upcCode     ) );   _upcCode     = std::move( oldUpcCode     );
+  auto oldBrandName   = std::move( groceryItem ).brandName  ();   groceryItem.brandName  ( std::move( _brandName   ) );   _brandName   = std::move( oldBrandName   );
+  auto oldProductName = std::move( groceryItem ).productName();   groceryItem.productName( std::move( _productName ) );   _productName = std::move( oldProductName );
+  groceryItem.price( price );
+
+  return { Status::PARSED, tokenEnd };
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  GroceryItemCursor
+*******************************************************************************/
+
+// Constructor
+GroceryItemCursor::GroceryItemCursor( std::istream & stream, std::size_t batchSize, std::size_t chunkSize, OnMalformed onMalformed )
+  : _stream     ( stream                                 ),
+    _chunkSize  ( std::max<std::size_t>( chunkSize, 1 )  ),
+    _onMalformed( onMalformed                            ),
+    _batch      ( std::max<std::size_t>( batchSize, 1 )  )
+{}
+
+
+
+// next()
+std::span<GroceryItem const> GroceryItemCursor::next()
+{
+  std::size_t count = 0;
+  while( count < _batch.size()  &&  !_malformed )
+  {
+    auto result = _parser.parse( _buffer.data() + _begin, _buffer.data() + _end, _endOfInput, _batch[count] );
+
+    if( result.status == GroceryItemParser::Status::PARSED )
+    {
+      _begin     = static_cast<std::size_t>( result.next - _buffer.data() );
+      _resyncing = false;
+      ++count;
+    }
+    else if( result.status == GroceryItemParser::Status::INCOMPLETE )   refill();
+    else if( result.status == GroceryItemParser::Status::MALFORMED  )
+    {
+      if( _onMalformed == OnMalformed::STOP )   _malformed = true;
+      else                                      reject( result.reason );
+    }
+    else                                                                break;                 // END_OF_INPUT
+  }
+
+  _itemsRead += count;
+  return { _batch.data(), count };
+}
+
+
+
+// refill()
+void GroceryItemCursor::refill()
+{
+  // Slide the unparsed input to the front, then read a chunk after it.  The buffer only grows when a partial record plus a chunk
+  // doesn't fit, so it settles at a chunk plus the longest record.
+  lineAt( _begin );
+  std::copy( _buffer.begin() + static_cast<std::ptrdiff_t>( _begin ), _buffer.begin() + static_cast<std::ptrdiff_t>( _end ), _buffer.begin() );
+  _end        -= _begin;
+  _begin       = 0;
+  _lineCounted = 0;
+
+  if( _buffer.size() < _end + _chunkSize )   _buffer.resize( _end + _chunkSize );
+
+  _stream.read( _buffer.data() + _end, static_cast<std::streamsize>( _chunkSize ) );
+  _end += static_cast<std::size_t>( _stream.gcount() );
+
+  if( !_stream )   _endOfInput = true;                                              // end of file (or a read error), either way there's no more
+}
+
+
+
+// reject()
+void GroceryItemCursor::reject( char const * reason )
+{
+  // The rejected record starts at its first non-space character, whitespace between records is never part of one
+  while( _begin < _end  &&  std::isspace( static_cast<unsigned char>( _buffer[_begin] ) ) )   ++_begin;
+  auto const line         = lineAt( _begin );
+  auto const startsRecord = _begin < _end  &&  _buffer[_begin] == '"';               // a record always opens with its quoted UPC code
+
+  // Find the end of the line, reading on if it runs past the buffer.  Refilling slides the buffer, so track progress relative to _begin.
+  std::size_t scanned = 0, lineEnd = 0;
+  for( ;; )
+  {
+    auto newline = std::find( _buffer.begin() + static_cast<std::ptrdiff_t>( _begin + scanned ), _buffer.begin() + static_cast<std::ptrdiff_t>( _end ), '\n' );
+    lineEnd      = static_cast<std::size_t>( newline - _buffer.begin() );
+
+    if( lineEnd < _end  ||  _endOfInput )   break;
+    scanned = _end - _begin;
+    refill();
+  }
+
+  // While resyncing, a line that can't even begin a record is more of the record already rejected, perhaps its later lines.  One
+  // that opens like a record is a bad record of its own.
+  if( !_resyncing  ||  startsRecord )
+  {
+    ++_rejectedCount;
+    if( _rejections.size() < MAX_LOGGED )
+    {
+      auto excerptEnd = std::min( lineEnd, _begin + EXCERPT_LENGTH );
+      if( excerptEnd > _begin  &&  _buffer[excerptEnd - 1] == '\r' )   --excerptEnd;
+      _rejections.push_back( { line, reason, std::string( _buffer.data() + _begin, _buffer.data() + excerptEnd ) } );
+    }
+    _resyncing = true;
+  }
+
+  // Try the next line, which either starts the next complete record (and ends the resync) or is rejected in turn
+  _begin = std::min( lineEnd + 1, _end );
+}
+
+
+
+// lineAt()
+std::size_t GroceryItemCursor::lineAt( std::size_t offset )
+{
+  _line        += static_cast<std::size_t>( std::count( _buffer.data() + _lineCounted, _buffer.data() + offset, '\n' ) );
+  _lineCounted  = offset;
+  return _line;
+}
@@ -0,0 +1,144 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+// Parses the GroceryItem text format (see operator>>) directly from a character buffer, one record at a time:
+//
+//    "00034000020706",  "York",  "York Peppermint Patties Dark Chocolate Covered Snack Size",  12.64
+//
+// Fields are double quoted with backslash escaping the next character, as std::quoted writes them.  Whitespace, including line
+// breaks, may appear around fields and between records.  A record cut off by the end of the buffer is reported as incomplete so
+// the caller can append more input and parse it again from the same place.
+//
+// Parsed strings are built in the parser's own buffers and then swapped with the grocery item's, so parsing into the same grocery
+// items over and over reuses their string capacity instead of allocating.
+class GroceryItemParser
+{
+  public:
+    enum class Status { PARSED, INCOMPLETE, MALFORMED, END_OF_INPUT };
+
+    struct Result
+    {
+      Status       status;
+      char const * next;                                                                      // PARSED: one past the record.  MALFORMED: where parsing failed.  Otherwise: first
+      char const * reason = nullptr;                                                          // MALFORMED only, a short static description
+    };
+
+    // groceryItem is updated only if a record is parsed.  If endOfInput is false, a record reaching last is INCOMPLETE; otherwise
+    // it's MALFORMED, and whitespace alone is END_OF_INPUT.
+    Result parse( char const * first, char const * last, bool endOfInput, GroceryItem & groceryItem );
+
+  private:
+    std::string _upcCode;
+    std::string _brandName;
+    std::string _productName;
+};
+
+
+
+
+// A streaming cursor over the GroceryItem text format, yielding one batch of grocery items at a time.
+//
+// Input is read in fixed size chunks into a reusable buffer (which settles at a chunk plus the longest record), and each batch is
+// parsed into the same reusable grocery items, so memory stays constant however large the input is.  Each batch is
+// valid until the next call to next().
+//
+// By default, as with operator>>, reading stops at the first malformed record.  For bulk imports, OnMalformed::SKIP instead
+// rejects the malformed record, logging the line it starts on, the reason, and an excerpt, and resumes at the start of the next
+// complete record.  Records may span lines, so that's the next line a whole record parses from.  Lines before it that open with a
+// quote, as every record does, are rejected and logged as records of their own; lines that can't begin a record are taken as the
+// rest of the rejected one.  Line numbers are counted lazily, only up to where they're needed, so a rejection costs about as much as
+// parsing the record would have.
+//
+//    GroceryItemCursor cursor( feed );
+//    for( auto batch = cursor.next();  !batch.empty();  batch = cursor.next() )   for( auto && groceryItem : batch ) ...
+class GroceryItemCursor
+{
+  public:
+    // Types and Exceptions
+    enum class OnMalformed { STOP, SKIP };
+
+    struct Rejection
+    {
+      std::size_t  line;                                                                      // one-based line the rejected record starts on
+      char const * reason;                                                                    // a short static description
+      std::string  excerpt;                                                                   // the start of the rejected record's first line, at most EXCERPT_LENGTH characters
+    };
+
+    static constexpr std::size_t EXCERPT_LENGTH = 80;
+    static constexpr std::size_t MAX_LOGGED     = 1'000;                                      // rejections beyond this are counted but not logged
+
+
+    explicit GroceryItemCursor( std::istream & stream, std::size_t batchSize = 4'096, std::size_t chunkSize = 64 * 1024, OnMalformed onMalformed = OnMalformed::STOP );
+
+    // Queries
+    std::size_t                    itemsRead    () const noexcept { return _itemsRead;     }  // total across all batches so far
+    bool                           malformed    () const noexcept { return _malformed;     }  // true if reading stopped at a malformed record rather than the end of input
+    std::size_t                    rejectedCount() const noexcept { return _rejectedCount; }  // OnMalformed::SKIP only, every record rejected so far
+    std::vector<Rejection> const & rejections   () const noexcept { return _rejections;    }  // OnMalformed::SKIP only, the first MAX_LOGGED of them
+
+
+    // Accessors
+    std::span<GroceryItem const> next();                                                      // the next batch, empty once input is exhausted
+
+    template<typename Predicate>
+    std::size_t insertInto( GroceryList & groceryList, Predicate keep );                      // reads the rest of the input, inserting kept grocery items at the bottom; returns the number kept
+
+
+  private:
+    std::istream &           _stream;
+    std::vector<char>        _buffer;
+    std::size_t              _chunkSize;
+    OnMalformed              _onMalformed;
+    std::size_t              _begin         = 0;                                              // unparsed input is _buffer[_begin, _end)
+    std::size_t              _end           = 0;
+    bool                     _endOfInput    = false;
+    std::size_t              _line          = 1;                                              // _buffer[_lineCounted] is on this (one-based) line
+    std::size_t              _lineCounted   = 0;
+
+    std::vector<GroceryItem> _batch;
+    GroceryItemParser        _parser;
+    std::size_t              _itemsRead     = 0;
+    bool                     _malformed     = false;
+    bool                     _resyncing     = false;                                          // OnMalformed::SKIP, looking for the next complete record after a rejection
+    std::size_t              _rejectedCount = 0;
+    std::vector<Rejection>   _rejections;
+
+    void        refill();                                                                     // keeps the unparsed input and appends at least one more chunk
+    void        reject( char const * reason );                                                // logs the record at _begin (unless it continues one already rejected) and skips to the next line
+    std::size_t lineAt( std::size_t offset );                                                 // the line _buffer[offset] is on, offset must not precede the last one asked about
+};
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// insertInto()
+template<typename Predicate>
+std::size_t GroceryItemCursor::insertInto( GroceryList & groceryList, Predicate keep )
+{
+  std::size_t inserted = 0;
+  for( auto batch = next();  !batch.empty();  batch = next() )
+  {
+    for( auto && groceryItem : batch )
+    {
+      if( !keep( groceryItem ) )   continue;
+      groceryList.insert( groceryItem, GroceryList::Position::BOTTOM );
+      ++inserted;
+    }
+  }
+  return inserted;
+}
@@ -0,0 +1,201 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision(), quoted()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <sstream>
+#include <string>                                                         // to_string()
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryItemCursor.hpp"
+#include "GroceryList.hpp"
+
+
+
+namespace    // anonymous
+{
+  class GroceryItemCursorRegressionTest
+  {
+    public:
+      GroceryItemCursorRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_grocery_item_cursor_tests;
+
+
+
+
+  // Reads everything through the cursor, copying each batch out before asking for the next
+  std::vector<GroceryItem> readAll( GroceryItemCursor & cursor )
+  {
+    std::vector<GroceryItem> result;
+    for( auto batch = cursor.next();  !batch.empty();  batch = cursor.next() )   result.insert( result.end(), batch.begin(), batch.end() );
+    return result;
+  }
+
+
+
+
+  void GroceryItemCursorRegressionTest::test()
+  {
+    {
+      // Tiny chunks and batches force records to straddle chunk boundaries, including mid-escape and mid-price
+      std::string text = "\"00034000020706\",  \"York\",  \"York Peppermint Patties\",  12.64\n"
+                         "  \"051600080015\",\"Heinz\",\"Ketchup \\\"Classic\\\" \\\\ 2 Ct\",+1.5\n\n"
+                         "\"0001\" , \"Brand, Inc\" ,\n \"Product\" , 12.   ";
+
+      std::istringstream feed( text ), reference( text );
+      GroceryItemCursor  cursor( feed, 2, 7 );
+
+      auto items = readAll( cursor );
+
+      std::vector<GroceryItem> expected;
+      for( GroceryItem groceryItem; reference >> groceryItem; )   expected.push_back( groceryItem );
+
+      affirm.is_equal( "Cursor:  Item count",                     3U,     items.size() );
+      affirm.is_true ( "Cursor:  Matches operator>>",             items == expected );
+      affirm.is_equal( "Cursor:  Escaped quote and backslash",    std::string( "Ketchup \"Classic\" \\ 2 Ct" ), items.size() > 1 ? items[1].productName() : std::string{} );
+      affirm.is_equal( "Cursor:  Items read",                     3U,     cursor.itemsRead() );
+      affirm.is_true ( "Cursor:  Clean end of input",             !cursor.malformed() );
+    }
+
+    {
+      // A large feed in small batches round trips through operator<<
+      std::vector<GroceryItem> written;
+      std::ostringstream       out;
+      for( unsigned i = 0; i < 10'000; ++i )
+      {
+        written.push_back( { "product " + std::to_string( i ), "brand \"" + std::to_string( i % 17 ) + '"', std::to_string( 100'000 + i ), i * 0.25 } );
+        out << written.back() << '\n';
+      }
+
+      std::istringstream feed( out.str() );
+      GroceryItemCursor  cursor( feed, 256, 4'096 );
+      affirm.is_true( "Cursor:  Large feed round trips", readAll( cursor ) == written  &&  !cursor.malformed() );
+    }
+
+    {
+      std::istringstream feed( "\"1\", \"A\", \"a\", 1.00\n"
+                               "\"2\", \"B\", \"b\", 2.00\n"
+                               "\"3\", \"C\"  \"c\", 3.00\n"
+                               "\"4\", \"D\", \"d\", 4.00\n" );
+      GroceryItemCursor  cursor( feed );
+
+      affirm.is_equal( "Malformed:  Stops before the bad record", 2U, readAll( cursor ).size() );
+      affirm.is_true ( "Malformed:  Reported",                   cursor.malformed() );
+      affirm.is_true ( "Malformed:  Stays stopped",              cursor.next().empty() );
+
+      GroceryItemParser parser;
+      GroceryItem       groceryItem;
+      std::string       bad = "\"1\", \"A\", \"a\", 1.0x ";
+      auto              result = parser.parse( bad.data(), bad.data() + bad.size(), true, groceryItem );
+      affirm.is_true ( "Malformed:  Price must be a number",     result.status == GroceryItemParser::Status::MALFORMED  &&  groceryItem == GroceryItem{} );
+    }
+
+    {
+      // Skipping malformed records:  each bad row is logged with its line and the rest of the feed still loads
+      std::ostringstream out;
+      std::string        longLine( 5'000, 'x' );
+      for( unsigned i = 1; i <= 10'000; ++i )
+      {
+        if     ( i ==     2 )   out << "\"2\", \"B\"  \"b\", 2.00\n";                              // missing comma
+        else if( i == 5'000 )   out << "\"5000\", \"E, \"e\", " << longLine << "\r\n";           // unbalanced quotes on a line longer than a chunk
+        else if( i == 9'999 )   out << "\"9999\", \"Y\", \"y\", 9.9.9\n";                       // bad price
+        else                    out << GroceryItem{ "p", "b", std::to_string( i ), 1.0 } << '\n';
+      }
+      out << "\"tail\", \"T\", \"t";                                                       // unterminated at end of input
+
+      std::istringstream feed( out.str() );
+      GroceryItemCursor  cursor( feed, 64, 1'024, GroceryItemCursor::OnMalformed::SKIP );
+
+      auto items = readAll( cursor );
+      bool inOrder = items.size() == 9'997;
+      for( std::size_t i = 0, expected = 1;  inOrder  &&  i < items.size();  ++i, ++expected )
+      {
+        while( expected == 2  ||  expected == 5'000  ||  expected == 9'999 )   ++expected;
+        inOrder = items[i].upcCode() == std::to_string( expected );
+      }
+
+      auto const & rejections = cursor.rejections();
+      affirm.is_true ( "Skip:  Good rows all loaded, in order", inOrder  &&  !cursor.malformed() );
+      affirm.is_equal( "Skip:  Rejected count",                 4U, cursor.rejectedCount() );
+      affirm.is_true ( "Skip:  Rejected line numbers",          rejections.size() == 4  &&  rejections[0].line ==     2  &&  rejections[1].line ==  5'000
+                                                                                     &&  rejections[2].line == 9'999  &&  rejections[3].line == 10'001 );
+      affirm.is_equal( "Skip:  Excerpt",                        std::string( "\"2\", \"B\"  \"b\", 2.00" ), rejections.empty() ? std::string{} : rejections[0].excerpt );
+      affirm.is_true ( "Skip:  Long excerpt truncated",         rejections.size() > 1  &&  rejections[1].excerpt.size() == GroceryItemCursor::EXCERPT_LENGTH );
+      affirm.is_true ( "Skip:  Reason recorded",                rejections.size() > 2  &&  std::string( rejections[2].reason ) == "expected a price" );
+    }
+
+    {
+      // A broken record spanning lines is rejected once, and reading resumes at the next complete record rather than mid-record
+      std::istringstream feed( "\"1\", \"A\", \"a\", 1.00\n"
+                               "\"2\"\n"
+                               "   , \"B\"\n"
+                               "   , \"b\"  2.00\n"
+                               "\"3\", \"C\",\n"
+                               "   \"c\", 3.00\n" );
+      GroceryItemCursor  cursor( feed, 64, 1'024, GroceryItemCursor::OnMalformed::SKIP );
+
+      auto items = readAll( cursor );
+      affirm.is_true ( "Skip:  Multi-line record, neighbours loaded", items.size() == 2  &&  items[0].upcCode() == "1"  &&  items[1].upcCode() == "3" );
+      affirm.is_equal( "Skip:  Multi-line record rejected once",      1U, cursor.rejectedCount() );
+      affirm.is_true ( "Skip:  Multi-line record's first line",       cursor.rejections().size() == 1  &&  cursor.rejections()[0].line == 2 );
+    }
+
+    {
+      // Consecutive bad rows are separate records, each rejected and logged in turn
+      std::istringstream feed( "\"1\", \"A\", \"a\", 1.00\n"
+                               "\"2\", \"B\"  \"b\", 2.00\n"
+                               "\"3\", \"C\", \"c\", 3.0x\n"
+                               "\"4\" \"D\", \"d\", 4.00\n"
+                               "\"5\", \"E\", \"e\", 5.00\n" );
+      GroceryItemCursor  cursor( feed, 64, 1'024, GroceryItemCursor::OnMalformed::SKIP );
+
+      auto         items      = readAll( cursor );
+      auto const & rejections = cursor.rejections();
+      affirm.is_true ( "Skip:  Consecutive bad rows, neighbours loaded", items.size() == 2  &&  items[0].upcCode() == "1"  &&  items[1].upcCode() == "5" );
+      affirm.is_equal( "Skip:  Consecutive bad rows each counted",       3U, cursor.rejectedCount() );
+      affirm.is_true ( "Skip:  Consecutive bad rows each logged",        rejections.size() == 3  &&  rejections[0].line == 2  &&  rejections[1].line == 3  &&  rejections[2].line == 4
+                                                                                             &&  rejections[1].excerpt == "\"3\", \"C\", \"c\", 3.0x" );
+    }
+
+    {
+      std::ostringstream out;
+      for( unsigned i = 0; i < 50; ++i )   out << GroceryItem{ "product " + std::to_string( i ), "brand", std::to_string( i ), i * 1.0 } << '\n';
+
+      std::istringstream feed( out.str() );
+      GroceryItemCursor  cursor( feed, 8 );
+      GroceryList        groceryList;
+
+      auto kept = cursor.insertInto( groceryList, []( GroceryItem const & groceryItem ) { return groceryItem.price() < 10.0; } );
+      affirm.is_true( "Insert into:  Only kept items inserted", kept == 10  &&  groceryList.size() == 10  &&  cursor.itemsRead() == 50 );
+    }
+  }
+
+
+
+
+  GroceryItemCursorRegressionTest::GroceryItemCursorRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nGroceryItemCursor Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nGroceryItemCursor Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class GroceryItemCursor\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,185 @@
+#include <bit>                                                                      // countr_zero()
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint8_t, uint32_t, uint64_t
+#include <functional>                                                               // hash<>
+#include <string_view>
+#include <utility>                                                                  // swap()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryItemSet.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // Final mixing step of SplitMix64.  std::hash of a string is good at spreading the low bits, but the set takes its group from
+  // the high bits and the control byte from the low bits, so every bit needs to depend on every input bit.
+  constexpr std::uint64_t mix( std::uint64_t value ) noexcept
+  {
+    value ^= value >> 30;   value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;   value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Static member functions
+*******************************************************************************/
+
+// hash()
+std::uint64_t GroceryItemSet::hash( GroceryItem const & groceryItem ) noexcept
+{
+  std::hash<std::string_view> hasher;
+
+  std::uint64_t result = 0x9E3779B97F4A7C15ULL;
+  result = mix( result ^ hasher( groceryItem.upcCode    () ) );
+  result = mix( result ^ hasher( groceryItem.brandName  () ) );
+  result = mix( result ^ hasher( groceryItem.productName() ) );
+  return result;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Modifiers
+*******************************************************************************/
+
+// insert()
+void GroceryItemSet::insert( std::uint64_t hashValue, Slot slot )
+{
+  // Keep the load (including tombstones) at or under 7/8.  If tombstones are the reason we're full, rehashing in place reclaims them,
+  // otherwise grow.
+  if( ( _size + _tombstones + 1 ) * 8 > _control.size() * 7 )
+  {
+    auto groupCount = _control.size() / GROUP_WIDTH;
+    if     ( groupCount == 0                                  )   groupCount  = 1;
+    else if( ( _size + 1 ) * 16 > _control.size() * 7         )   groupCount *= 2;      // more than 7/16 full of live entries
+    rehash( groupCount );
+  }
+
+  place( controlOf( hashValue ), { fingerprintOf( hashValue ), slot } );
+  ++_size;
+}
+
+
+
+// erase()
+bool GroceryItemSet::erase( std::uint64_t hashValue, Slot slot )
+{
+  if( _size == 0 )   return false;
+
+  auto const fingerprint = fingerprintOf( hashValue );
+  auto const control     = controlOf    ( hashValue );
+  auto const mask        = groupMask();
+
+  for( std::size_t group = fingerprint & mask, step = 1;  step <= mask + 1;  group = ( group + step++ ) & mask )
+  {
+    auto const groupHasEmpty = matchByte( group, EMPTY ) != 0;
+
+    for( std::uint16_t candidates = matchByte( group, control );  candidates != 0;  candidates &= candidates - 1 )
+    {
+      auto bucket = group * GROUP_WIDTH + static_cast<std::size_t>( std::countr_zero( candidates ) );
+      if( _entries[bucket].fingerprint != fingerprint  ||  _entries[bucket].slot != slot )   continue;
+
+      // Probes always stop at a group with an empty bucket, so if this group has one nobody probes past it and the bucket can simply
+      // become empty.  Otherwise leave a tombstone so lookups keep probing.
+      if( groupHasEmpty )   _control[bucket] = EMPTY;
+      else                { _control[bucket] = DELETED;  ++_tombstones; }
+
+      --_size;
+      return true;
+    }
+
+    if( groupHasEmpty )   return false;
+  }
+  return false;
+}
+
+
+
+// shiftSlots()
+void GroceryItemSet::shiftSlots( Slot first, int delta ) noexcept
+{
+  // Slots aren't hashed, so entries stay in their buckets and only the slot numbers change
+  for( std::size_t bucket = 0; bucket < _control.size(); ++bucket )
+  {
+    if( ( _control[bucket] & 0x80 ) == 0  &&  _entries[bucket].slot >= first )   _entries[bucket].slot = static_cast<Slot>( static_cast<std::int64_t>( _entries[bucket].slot ) + delta );
+  }
+}
+
+
+
+// clear()
+void GroceryItemSet::clear() noexcept
+{
+  _control.clear();
+  _entries.clear();
+  _size       = 0;
+  _tombstones = 0;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Private member functions
+*******************************************************************************/
+
+// rehash()
+void GroceryItemSet::rehash( std::size_t groupCount )
+{
+  std::vector<std::uint8_t> oldControl( groupCount * GROUP_WIDTH, EMPTY );
+  std::vector<Entry>        oldEntries( groupCount * GROUP_WIDTH );
+  std::swap( oldControl, _control );
+  std::swap( oldEntries, _entries );
+  _tombstones = 0;
+
+  // The fingerprint and control byte together hold every hash bit the set uses, so entries move without rehashing the items
+  for( std::size_t bucket = 0; bucket < oldControl.size(); ++bucket )
+  {
+    if( ( oldControl[bucket] & 0x80 ) == 0 )   place( oldControl[bucket], oldEntries[bucket] );
+  }
+}
+
+
+
+// place()
+void GroceryItemSet::place( std::uint8_t control, Entry entry ) noexcept
+{
+  auto const mask = groupMask();
+
+  for( std::size_t group = entry.fingerprint & mask, step = 1;  ;  group = ( group + step++ ) & mask )
+  {
+    auto available = static_cast<std::uint16_t>( matchByte( group, EMPTY ) | matchByte( group, DELETED ) );
+    if( available == 0 )   continue;
+
+    auto bucket = group * GROUP_WIDTH + static_cast<std::size_t>( std::countr_zero( available ) );
+    if( _control[bucket] == DELETED )   --_tombstones;
+
+    _control[bucket] = control;
+    _entries[bucket] = entry;
+    return;
+  }
+}
@@ -0,0 +1,131 @@
+#pragma once                                                                                  // include guard
+
+#include <bit>                                                                                // countr_zero()
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint8_t, uint16_t, uint32_t, uint64_t
+#include <optional>
+#include <vector>
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>                                                                      // _mm_loadu_si128(), _mm_cmpeq_epi8(), _mm_movemask_epi8()
+#endif
+
+#include "GroceryItem.hpp"
+
+
+
+
+// A flat, open-addressed hash set of grocery item identities used to detect duplicates without scanning.
+//
+// The set never stores grocery items.  Each entry holds only a 32-bit fingerprint of the item and a slot number - whatever index
+// the owning container uses to reach the item (e.g. an offset into its array) - so the owner resolves candidates back to items
+// when a lookup needs to confirm a match.  Control bytes (one per bucket, holding 7 more hash bits) are kept apart from the
+// entries in groups of 16, and a lookup compares a whole group at once (SSE2 where available, otherwise a portable scalar loop).
+// Nearly every lookup touches one control group and one entry.  With a 7/8 maximum load the overhead is about 10 bytes per item.
+//
+// Grocery item equality allows a small tolerance on price, so price is intentionally not hashed.  Items differing only by price
+// share a hash and are told apart by the owner's equality check.
+class GroceryItemSet
+{
+  public:
+    using Slot = std::uint32_t;
+
+    static std::uint64_t hash( GroceryItem const & groceryItem ) noexcept;                   // hashes UPC code, brand name, and product name
+
+
+    // Queries
+    std::size_t size() const noexcept { return _size; }
+
+
+    // Accessors
+    template<typename IsSlotEqual>                                                            // IsSlotEqual:  bool( Slot ), does the item at Slot equal the one searched for?
+    std::optional<Slot> find( std::uint64_t hashValue, IsSlotEqual && isSlotEqual ) const;
+
+
+    // Modifiers
+    void insert( std::uint64_t hashValue, Slot slot );                                        // the caller ensures the item isn't already present
+    bool erase ( std::uint64_t hashValue, Slot slot );                                        // returns false if no entry for slot has that hash
+    void shiftSlots( Slot first, int delta )          noexcept;                               // adds delta to every slot >= first, for owners whose slots are positions that shift
+    void clear ()                                     noexcept;
+
+
+  private:
+    static constexpr std::size_t  GROUP_WIDTH = 16;
+    static constexpr std::uint8_t EMPTY       = 0x80;                                         // full buckets hold 7 hash bits, so the high bit marks the special states
+    static constexpr std::uint8_t DELETED     = 0xFE;
+
+    struct Entry
+    {
+      std::uint32_t fingerprint;                                                              // high 32 bits of the hash, also selects the first group probed
+      Slot          slot;
+    };
+
+    // Instance Attributes
+    std::vector<std::uint8_t> _control;                                                       // one byte per bucket, GROUP_WIDTH buckets per group
+    std::vector<Entry>        _entries;
+    std::size_t               _size       = 0;
+    std::size_t               _tombstones = 0;
+
+
+    // Helper member functions
+    static std::uint32_t fingerprintOf( std::uint64_t hashValue ) noexcept { return static_cast<std::uint32_t>( hashValue >> 32 ); }
+    static std::uint8_t  controlOf    ( std::uint64_t hashValue ) noexcept { return static_cast<std::uint8_t >( hashValue & 0x7F ); }
+
+    std::size_t   groupMask  ()                                  const noexcept { return _control.size() / GROUP_WIDTH - 1; }
+    std::uint16_t matchByte  ( std::size_t group, std::uint8_t byte ) const noexcept;    // bit i set if bucket i of the group holds byte
+    void          rehash     ( std::size_t groupCount );
+    void          place      ( std::uint8_t control, Entry entry )  noexcept;            // stores into the first free bucket of the probe sequence
+};
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Inline and template member functions
+*******************************************************************************/
+
+// matchByte() const
+inline std::uint16_t GroceryItemSet::matchByte( std::size_t group, std::uint8_t byte ) const noexcept
+{
+  auto const * controlGroup = _control.data() + group * GROUP_WIDTH;
+
+  #if defined( __SSE2__ )
+    auto controlBytes = _mm_loadu_si128( reinterpret_cast<__m128i const *>( controlGroup ) );
+    auto matches      = _mm_cmpeq_epi8( controlBytes, _mm_set1_epi8( static_cast<char>( byte ) ) );
+    return static_cast<std::uint16_t>( _mm_movemask_epi8( matches ) );
+  #else
+    std::uint16_t mask = 0;
+    for( std::size_t i = 0; i < GROUP_WIDTH; ++i )   mask |= static_cast<std::uint16_t>( ( controlGroup[i] == byte ) << i );
+    return mask;
+  #endif
+}
+
+
+
+// find() const
+template<typename IsSlotEqual>
+std::optional<GroceryItemSet::Slot> GroceryItemSet::find( std::uint64_t hashValue, IsSlotEqual && isSlotEqual ) const
+{
+  if( _size == 0 )   return std::nullopt;
+
+  auto const fingerprint = fingerprintOf( hashValue );
+  auto const control     = controlOf    ( hashValue );
+  auto const mask        = groupMask();
+
+  // Triangular probing over groups visits every group exactly once when the group count is a power of two
+  for( std::size_t group = fingerprint & mask, step = 1;  step <= mask + 1;  group = ( group + step++ ) & mask )
+  {
+    for( std::uint16_t candidates = matchByte( group, control );  candidates != 0;  candidates &= candidates - 1 )
+    {
+      auto const & entry = _entries[group * GROUP_WIDTH + static_cast<std::size_t>( std::countr_zero( candidates ) )];
+      if( entry.fingerprint == fingerprint  &&  isSlotEqual( entry.slot ) )   return entry.slot;
+    }
+
+    if( matchByte( group, EMPTY ) != 0 )   return std::nullopt;                              // an item in this probe sequence would have stopped here
+  }
+  return std::nullopt;
+}
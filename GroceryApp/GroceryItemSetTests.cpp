@@ -0,0 +1,111 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <string>                                                         // to_string()
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryItemSet.hpp"
+
+
+
+namespace    // anonymous
+{
+  class GroceryItemSetRegressionTest
+  {
+    public:
+      GroceryItemSetRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_grocery_item_set_tests;
+
+
+
+
+  void GroceryItemSetRegressionTest::test()
+  {
+    // The set stores slots, so keep the grocery items in a vector and use their indexes as slots
+    std::vector<GroceryItem> storage;
+    GroceryItemSet           set;
+
+    auto find = [&]( GroceryItem const & groceryItem )
+    {
+      return set.find( GroceryItemSet::hash( groceryItem ), [&]( GroceryItemSet::Slot slot ) { return storage[slot] == groceryItem; } );
+    };
+
+    {
+      affirm.is_true( "Empty set finds nothing", !find( GroceryItem{ "milk" } ) );
+
+      storage = { { "milk", "", "", 1.00 }, { "milk", "", "", 2.00 }, { "eggs" } };
+      for( GroceryItemSet::Slot slot = 0; slot < storage.size(); ++slot )   set.insert( GroceryItemSet::hash( storage[slot] ), slot );
+
+      affirm.is_equal( "Items differing only by price are distinct 1", 0U, find( { "milk", "", "", 1.00 } ).value_or( 99 ) );
+      affirm.is_equal( "Items differing only by price are distinct 2", 1U, find( { "milk", "", "", 2.00 } ).value_or( 99 ) );
+      affirm.is_equal( "Price within tolerance matches",               0U, find( { "milk", "", "", 1.00001 } ).value_or( 99 ) );
+      affirm.is_true ( "Absent item not found",                        !find( { "milk", "Brand" } ) );
+
+      affirm.is_true ( "Erase by slot",                                set.erase( GroceryItemSet::hash( storage[0] ), 0 ) );
+      affirm.is_true ( "Erased item not found",                        !find( { "milk", "", "", 1.00 } ) );
+      affirm.is_equal( "Erase keeps the other price",                  1U, find( { "milk", "", "", 2.00 } ).value_or( 99 ) );
+      affirm.is_true ( "Erase of missing slot fails",                  !set.erase( GroceryItemSet::hash( storage[0] ), 0 ) );
+      affirm.is_equal( "Size after erase",                             2U, set.size() );
+
+      // Slots as positions:  erasing storage[0] moves the rest up one
+      storage.erase( storage.begin() );
+      set.shiftSlots( 1, -1 );
+      affirm.is_true ( "Shifted slots follow their items",             find( { "milk", "", "", 2.00 } ) == 0U  &&  find( GroceryItem{ "eggs" } ) == 1U );
+    }
+
+    {
+      // Grow through many rehashes, then churn half the entries out and back in so tombstones accumulate and get reclaimed
+      set.clear();
+      storage.clear();
+      for( unsigned i = 0; i < 50'000; ++i )
+      {
+        storage.emplace_back( "product " + std::to_string( i ), "brand " + std::to_string( i % 7 ), std::to_string( i ) );
+        set.insert( GroceryItemSet::hash( storage.back() ), i );
+      }
+
+      for( unsigned round = 0; round < 3; ++round )
+      {
+        for( unsigned i = round % 2; i < storage.size(); i += 2 )   set.erase ( GroceryItemSet::hash( storage[i] ), i );
+        for( unsigned i = round % 2; i < storage.size(); i += 2 )   set.insert( GroceryItemSet::hash( storage[i] ), i );
+      }
+
+      bool allFound = true;
+      for( GroceryItemSet::Slot slot = 0; slot < storage.size(); ++slot )   allFound = allFound && find( storage[slot] ) == slot;
+
+      affirm.is_equal( "Large set:  Size",        storage.size(), set.size() );
+      affirm.is_true ( "Large set:  all found",   allFound );
+      affirm.is_true ( "Large set:  absent item", !find( { "product 50000" } ) );
+    }
+  }
+
+
+
+
+  GroceryItemSetRegressionTest::GroceryItemSetRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nGroceryItemSet Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nGroceryItemSet Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class GroceryItemSet\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -1,14 +1,24 @@
 #include <algorithm>                                                                // find(), move(), move_backward(), equal(), swap(), lexicographical_compare()
+#include <array>
 #include <cmath>                                                                    // min()
 #include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint64_t
 #include <initializer_list>
 #include <iomanip>                                                                  // setw()
-#include <iterator>                                                                 // distance(), next()
+#include <iterator>                                                                 // next(), prev()
+#include <optional>
 #include <stdexcept>                                                                // logic_error
 #include <string>
+#include <string_view>
+#include <utility>                                                                  // move()
+#include <vector>
 
+#include "BitSequence.hpp"
 #include "GroceryItem.hpp"
+#include "GroceryItemSet.hpp"
 #include "GroceryList.hpp"
+#include "Instrumentation.hpp"
+#include "ProductSearchIndex.hpp"
 
 
 
@@ -25,6 +35,8 @@
 // Initializer List Constructor
 GroceryList::GroceryList( const std::initializer_list<GroceryItem> & initList )
 {
+  INSTRUMENT_SCOPE( LIST_CONSTRUCT );
+
   for( auto && groceryItem : initList )   insert( groceryItem, Position::BOTTOM );
 
   // Verify the internal grocery list state is still consistent amongst the four containers
@@ -33,6 +45,81 @@ GroceryList::GroceryList( const std::initializer_list<GroceryItem> & initList )
 
 
 
+// Copy Constructor
+GroceryList::GroceryList( GroceryList const & other )
+  : _gList_array     ( other._gList_array      ),
+    _gList_vector    ( other._gList_vector     ),
+    _gList_dll       ( other._gList_dll        ),
+    _gList_sll       ( other._gList_sll        ),
+    _gList_index     ( other._gList_index      ),
+    _gList_flags     ( other._gList_flags      ),
+    _gList_array_size( other._gList_array_size ),
+    _gList_sll_size  ( other._gList_sll_size   ),
+    _gList_fingerprint( other._gList_fingerprint )
+{
+  INSTRUMENT_COUNT( LIST_COPY, 1 );
+
+  // The source's tail iterator refers to the source's nodes, so find this list's own tail.  Copying was linear anyway.
+  for( auto next = std::next( _gList_sll_tail );  next != _gList_sll.end();  ++next )   _gList_sll_tail = next;
+}
+
+
+
+// Move Constructor
+GroceryList::GroceryList( GroceryList && other ) noexcept
+  : _gList_array     ( std::move( other._gList_array  ) ),
+    _gList_vector    ( std::move( other._gList_vector ) ),
+    _gList_dll       ( std::move( other._gList_dll    ) ),
+    _gList_sll       ( std::move( other._gList_sll    ) ),
+    _gList_index     ( std::move( other._gList_index  ) ),
+    _gList_flags     ( std::move( other._gList_flags  ) ),
+    _gList_array_size( other._gList_array_size          ),
+    _gList_sll_size  ( other._gList_sll_size            ),
+    _gList_fingerprint( other._gList_fingerprint        )
+{
+  INSTRUMENT_COUNT( LIST_MOVE, 1 );
+
+  // Moving a forward_list transfers its nodes, so iterators to elements (but not before_begin()) now refer into this list
+  if( _gList_sll_size != 0 )   _gList_sll_tail = other._gList_sll_tail;
+  other.reset();
+}
+
+
+
+// Copy Assignment Operator
+GroceryList & GroceryList::operator=( GroceryList const & rhs )
+{
+  if( this != &rhs )   *this = GroceryList( rhs );
+  return *this;
+}
+
+
+
+// Move Assignment Operator
+GroceryList & GroceryList::operator=( GroceryList && rhs ) noexcept
+{
+  INSTRUMENT_COUNT( LIST_MOVE, 1 );
+
+  if( this != &rhs )
+  {
+    _gList_array      = std::move( rhs._gList_array  );
+    _gList_vector     = std::move( rhs._gList_vector );
+    _gList_dll        = std::move( rhs._gList_dll    );
+    _gList_sll        = std::move( rhs._gList_sll    );
+    _gList_index      = std::move( rhs._gList_index  );
+    _gList_flags      = std::move( rhs._gList_flags  );
+    _gList_array_size = rhs._gList_array_size;
+    _gList_sll_size   = rhs._gList_sll_size;
+    _gList_fingerprint = rhs._gList_fingerprint;
+    _gList_sll_tail   = _gList_sll_size == 0  ?  _gList_sll.before_begin()  :  rhs._gList_sll_tail;
+
+    rhs.reset();
+  }
+  return *this;
+}
+
+
+
 
 
 
@@ -50,6 +137,8 @@ GroceryList::GroceryList( const std::initializer_list<GroceryItem> & initList )
 // size() const
 std::size_t GroceryList::size() const
 {
+  INSTRUMENT_SCOPE( LIST_SIZE );
+
   // Verify the internal grocery list state is still consistent amongst the four containers
   if( !containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
 
@@ -61,6 +150,28 @@ std::size_t GroceryList::size() const
 
 
 
+// isFlagged() const
+bool GroceryList::isFlagged( std::size_t offsetFromTop, Flag flag ) const
+{
+  INSTRUMENT_SCOPE( LIST_FLAGS );
+
+  if( offsetFromTop >= _gList_array_size )   throw InvalidOffset_Ex( "Flag position beyond end of current list size" exception_location );
+  return flagBits( flag ).test( offsetFromTop );
+}
+
+
+
+// count() const
+std::size_t GroceryList::count( Flag flag, bool value ) const
+{
+  INSTRUMENT_SCOPE( LIST_FLAGS );
+
+  // A population count over the flag's words, 64 grocery items at a time
+  return flagBits( flag ).count( value );
+}
+
+
+
 
 
 
@@ -78,14 +189,56 @@ std::size_t GroceryList::size() const
 // find() const
 std::size_t GroceryList::find( const GroceryItem & groceryItem ) const
 {
+  INSTRUMENT_SCOPE( LIST_FIND );
+
   // Verify the internal grocery list state is still consistent amongst the four containers
   if( !containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
 
-  for (size_t i = 0; i < _gList_array_size; ++i){
-    if(_gList_array[i] == groceryItem) return i;
-  }
+  // Hash lookup straight to the grocery item's offset
+  auto offset = findOffset( groceryItem, GroceryItemSet::hash( groceryItem ) );
+  return offset  ?  *offset  :  _gList_array_size;
+}
 
-  return _gList_array_size;
+
+
+// search() const
+std::vector<std::size_t> GroceryList::search( std::string_view query, std::size_t k ) const
+{
+  INSTRUMENT_SCOPE( LIST_SEARCH );
+
+  // A grocery list holds at most a handful of grocery items, too few to be worth keeping a search index up to date on every insert
+  // and remove (or copying one with every list), so each grocery item is scored directly.  Positions in the vector are offsets.
+  return ProductSearchIndex::rank( query, _gList_vector, k );
+}
+
+
+
+// offsetsOf() const
+std::vector<std::size_t> GroceryList::offsetsOf( Flag flag, bool value ) const
+{
+  INSTRUMENT_SCOPE( LIST_FLAGS );
+
+  return flagBits( flag ).offsets( value );
+}
+
+
+
+// begin() const
+std::vector<GroceryItem>::const_iterator GroceryList::begin() const
+{
+  INSTRUMENT_SCOPE( LIST_BEGIN_END );
+
+  return _gList_vector.cbegin();
+}
+
+
+
+// end() const
+std::vector<GroceryItem>::const_iterator GroceryList::end() const
+{
+  INSTRUMENT_SCOPE( LIST_BEGIN_END );
+
+  return _gList_vector.cend();
 }
 
 
@@ -118,17 +271,17 @@ void GroceryList::insert( const GroceryItem & groceryItem, Position position )
 // insert( offset )
 void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFromTop )        // insert provided grocery item at offsetFromTop, which places it before the current grocery item at offsetFromTop
 {
+  INSTRUMENT_SCOPE( LIST_INSERT );                                                  // insert( position ) is counted here, where it delegates
+
   // Validate offset parameter before attempting the insertion.  std::size_t is an unsigned type, so no need to check for negative
   // offsets, and an offset equal to the size of the list says to insert at the end (bottom) of the list.  Anything greater than the
   // current size is an error.
-  if( offsetFromTop > size() ){   
-    InvalidOffset_Ex( "Insertion position beyond end of current list size" exception_location );
-  }
+  if( offsetFromTop > size() )   throw InvalidOffset_Ex( "Insertion position beyond end of current list size" exception_location );
 
   /**********  Prevent duplicate entries  ***********************/
   
-
-    if(find(groceryItem) != _gList_array_size) return ;
+  auto const hashValue = GroceryItemSet::hash( groceryItem );
+  if( findOffset( groceryItem, hashValue ) ) return;
 
 
   // Inserting into the grocery list means you insert the grocery item into each of the containers (array, vector, list, and
@@ -140,7 +293,8 @@ void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFro
   { /**********  Part 1 - Insert into array  ***********************/
     
 
-    if(_gList_array_size + 1 == _gList_array.size() ) throw CapacityExceeded_Ex("Cannot fit Another item into fixed size array");
+    if(_gList_array_size >= _gList_array.size() ) throw CapacityExceeded_Ex("Cannot fit Another item into fixed size array");
+    INSTRUMENT_COUNT( ARRAY_SHIFT, _gList_array_size - offsetFromTop );
 
     for(size_t i = _gList_array_size; i > offsetFromTop; --i){
       _gList_array[i] = std::move(_gList_array[i - 1]);
@@ -163,7 +317,10 @@ void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFro
 
   { /**********  Part 3 - Insert into doubly linked list  **********/
     
-    _gList_dll.insert(std::next(_gList_dll.begin(), offsetFromTop), groceryItem);
+    // Walk from whichever end is closer, so inserting at the bottom doesn't walk the whole list
+    auto position = offsetFromTop <= _gList_dll.size() / 2  ?  std::next( _gList_dll.begin(), offsetFromTop )
+                                                            :  std::prev( _gList_dll.end(),   _gList_dll.size() - offsetFromTop );
+    _gList_dll.insert(position, groceryItem);
   } // Part 3 - Insert into doubly linked list
 
 
@@ -171,10 +328,34 @@ void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFro
 
   { /**********  Part 4 - Insert into singly linked list  **********/
    
-    _gList_sll.insert_after(std::next(_gList_sll.before_begin(), offsetFromTop), groceryItem);
+    // Inserting at the bottom goes after the remembered tail, anywhere else requires walking to the node before offsetFromTop
+    bool atBottom = offsetFromTop == _gList_sll_size;
+    auto position = atBottom  ?  _gList_sll_tail  :  std::next(_gList_sll.before_begin(), offsetFromTop);
+    auto inserted = _gList_sll.insert_after(position, groceryItem);
+
+    if( atBottom )   _gList_sll_tail = inserted;
+    ++_gList_sll_size;
   } // Part 4 - Insert into singly linked list
 
 
+
+
+  { /**********  Part 5 - Insert into hash index  *****************/
+
+    _gList_index.shiftSlots(static_cast<GroceryItemSet::Slot>(offsetFromTop), +1);          // the grocery items below moved down one
+    _gList_index.insert(hashValue, static_cast<GroceryItemSet::Slot>(offsetFromTop));
+    _gList_fingerprint += hashValue;                                                        // unsigned, so wraps rather than overflows
+  } // Part 5 - Insert into hash index
+
+
+
+
+  { /**********  Part 6 - Insert cleared flags  *******************/
+
+    for( auto & flags : _gList_flags )   flags.insert( offsetFromTop );                    // flags from offsetFromTop on move toward the bottom with their grocery items
+  } // Part 6 - Insert cleared flags
+
+
   // Verify the internal grocery list state is still consistent amongst the four containers
   if( !containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
 } // insert( const GroceryItem & groceryItem, std::size_t offsetFromTop )
@@ -193,13 +374,17 @@ void GroceryList::remove( const GroceryItem & groceryItem )
 // remove( offset )
 void GroceryList::remove( std::size_t offsetFromTop )
 {
+  INSTRUMENT_SCOPE( LIST_REMOVE );                                                  // remove( groceryItem ) is counted here, where it delegates
   
 
   if( offsetFromTop >= size() )   return;                                           // no change occurs if (zero-based) offsetFromTop >= size()
 
+  auto const hashValue = GroceryItemSet::hash( _gList_vector[offsetFromTop] );       // taken before the grocery item leaves the containers
+
 
   { /**********  Part 1 - Remove from array  ***********************/
     
+    INSTRUMENT_COUNT( ARRAY_SHIFT, _gList_array_size - 1 - offsetFromTop );
     for(size_t i = offsetFromTop; i < _gList_array_size - 1; ++i){
       _gList_array.at(i) = _gList_array.at(i + 1);
     }
@@ -221,7 +406,9 @@ void GroceryList::remove( std::size_t offsetFromTop )
 
   { /**********  Part 3 - Remove from doubly linked list  **********/
     
-    _gList_dll.erase(std::next(_gList_dll.begin(), offsetFromTop));
+    auto position = offsetFromTop < _gList_dll.size() / 2  ?  std::next( _gList_dll.begin(), offsetFromTop )
+                                                           :  std::prev( _gList_dll.end(),   _gList_dll.size() - offsetFromTop );
+    _gList_dll.erase(position);
   } // Part 3 - Remove from doubly linked list
 
 
@@ -229,10 +416,32 @@ void GroceryList::remove( std::size_t offsetFromTop )
 
   {/**********  Part 4 - Remove from singly linked list  **********/
     
-    _gList_sll.erase_after(std::next(_gList_sll.before_begin(), offsetFromTop));
+    auto previous = std::next(_gList_sll.before_begin(), offsetFromTop);
+    _gList_sll.erase_after(previous);
+
+    if( offsetFromTop == _gList_sll_size - 1 )   _gList_sll_tail = previous;                // removed the last node, so the one before it is the new tail
+    --_gList_sll_size;
   } // Part 4 - Remove from singly linked list
 
 
+
+
+  {/**********  Part 5 - Remove from hash index  *****************/
+
+    _gList_index.erase(hashValue, static_cast<GroceryItemSet::Slot>(offsetFromTop));
+    _gList_index.shiftSlots(static_cast<GroceryItemSet::Slot>(offsetFromTop + 1), -1);     // the grocery items below moved up one
+    _gList_fingerprint -= hashValue;
+  } // Part 5 - Remove from hash index
+
+
+
+
+  {/**********  Part 6 - Remove flags  ****************************/
+
+    for( auto & flags : _gList_flags )   flags.erase( offsetFromTop );
+  } // Part 6 - Remove flags
+
+
   // Verify the internal grocery list state is still consistent amongst the four containers
   if( !containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
 } // remove( std::size_t offsetFromTop )
@@ -242,22 +451,44 @@ void GroceryList::remove( std::size_t offsetFromTop )
 // moveToTop()
 void GroceryList::moveToTop( const GroceryItem & groceryItem )
 {
+  INSTRUMENT_SCOPE( LIST_MOVE_TO_TOP );
+
   
-  if(find(groceryItem) != _gList_array_size){
-    remove(groceryItem);
+  auto offset = find(groceryItem);
+  if(offset != _gList_array_size){
+    // The grocery item keeps its flags as it moves
+    std::array<bool, FLAG_COUNT> flags{};
+    for( std::size_t i = 0; i < FLAG_COUNT; ++i )   flags[i] = _gList_flags[i].test( offset );
+
+    remove(offset);
     insert(groceryItem);
+
+    for( std::size_t i = 0; i < FLAG_COUNT; ++i )   _gList_flags[i].set( 0, flags[i] );
   }
   else return;
 }
 
 
 
+// setFlag()
+void GroceryList::setFlag( std::size_t offsetFromTop, Flag flag, bool value )
+{
+  INSTRUMENT_SCOPE( LIST_FLAGS );
+
+  if( offsetFromTop >= _gList_array_size )   throw InvalidOffset_Ex( "Flag position beyond end of current list size" exception_location );
+  flagBits( flag ).set( offsetFromTop, value );
+}
+
+
+
 // operator+=( initializer_list )
 GroceryList & GroceryList::operator+=( const std::initializer_list<GroceryItem> & rhs )
 {
+  INSTRUMENT_SCOPE( LIST_APPEND );
+
   
-  for(GroceryItem grocery : rhs){
-    insert(grocery, _gList_array_size + 1);
+  for(GroceryItem const & grocery : rhs){
+    insert(grocery, Position::BOTTOM);
   }
 
 
@@ -271,9 +502,16 @@ GroceryList & GroceryList::operator+=( const std::initializer_list<GroceryItem>
 // operator+=( GroceryList )
 GroceryList & GroceryList::operator+=( const GroceryList & rhs )
 {
+  INSTRUMENT_SCOPE( LIST_APPEND );
+
   
-  for(GroceryItem grocery : rhs._gList_array){
-    insert(grocery, Position::BOTTOM);
+  for(std::size_t i = 0; i < rhs._gList_vector.size(); ++i){       // only rhs's valid grocery items, not every slot of its array
+    auto bottom = _gList_array_size;
+    insert(rhs._gList_vector[i], Position::BOTTOM);
+
+    // Appended grocery items bring their flags along, duplicates that were ignored don't
+    if( _gList_array_size != bottom )
+      for( std::size_t f = 0; f < FLAG_COUNT; ++f )   _gList_flags[f].set( bottom, rhs._gList_flags[f].test( i ) );
   }
 
   // Verify the internal grocery list state is still consistent amongst the four containers
@@ -300,16 +538,23 @@ GroceryList & GroceryList::operator+=( const GroceryList & rhs )
 // operator<=>
 std::weak_ordering GroceryList::operator<=>( GroceryList const & rhs ) const
 {
-  if( !containersAreConsistant() || !rhs.containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
-
-  size_t temp = (size()) ? size() >= rhs.size() : rhs.size();
-
-  for(size_t i = 0; i < temp; ++i){
-    if(auto result = _gList_array[i] <=> rhs._gList_array[i]; result != 0) return result;
+  INSTRUMENT_SCOPE( LIST_COMPARE );
+
+  // The consistency audits walk every container of both lists, which would dominate the cost of an otherwise short-circuiting
+  // comparison (e.g. while sorting a collection of grocery lists).  Audit only in debug builds.
+  #ifndef NDEBUG
+    if( !containersAreConsistant() || !rhs.containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  #endif
+
+  // Lexicographical comparison over the common prefix, stopping at the first grocery item that differs.  If one list is a prefix of
+  // the other, the shorter list is ordered first.
+  auto const commonSize = std::min( _gList_vector.size(), rhs._gList_vector.size() );
+  for( std::size_t i = 0; i < commonSize; ++i )
+  {
+    if( auto result = _gList_vector[i] <=> rhs._gList_vector[i];  result != 0 )   return result;
   }
 
-  return size() <=> rhs.size();
-  
+  return _gList_vector.size() <=> rhs._gList_vector.size();
 }
 
 
@@ -317,15 +562,18 @@ std::weak_ordering GroceryList::operator<=>( GroceryList const & rhs ) const
 // operator==
 bool GroceryList::operator==( GroceryList const & rhs ) const
 {
-  if( !containersAreConsistant() || !rhs.containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  INSTRUMENT_SCOPE( LIST_EQUAL );
 
-  if(_gList_array_size != rhs._gList_array_size) return false;
-  for(size_t i = 0; i < _gList_array.size(); ++i){
-    if(_gList_array[i] != rhs._gList_array[i]) return false;
-  }
+  #ifndef NDEBUG
+    if( !containersAreConsistant() || !rhs.containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  #endif
 
+  // Lists of different lengths can never be equal, and neither can lists whose fingerprints differ (equal grocery items hash
+  // equally), so check those first and then compare only the valid elements, stopping at the first mismatch
+  if( _gList_vector.size() != rhs._gList_vector.size() )   return false;
+  if( _gList_fingerprint   != rhs._gList_fingerprint   )   return false;
 
-  return true;
+  return std::equal( _gList_vector.cbegin(), _gList_vector.cend(), rhs._gList_vector.cbegin() );
 }
 
 
@@ -347,16 +595,24 @@ bool GroceryList::operator==( GroceryList const & rhs ) const
 // containersAreConsistant() const
 bool GroceryList::containersAreConsistant() const
 {
+  INSTRUMENT_SCOPE( LIST_AUDIT );
+
   // Sizes of all containers must be equal to each other
   if(    _gList_array_size != _gList_vector.size()
       || _gList_array_size != _gList_dll.size()
-      || _gList_array_size !=  gList_sll_size() ) return false;
+      || _gList_array_size !=  gList_sll_size()
+      || _gList_array_size != _gList_index .size() ) return false;
+
+  for( auto && flags : _gList_flags )   if( flags.size() != _gList_array_size ) return false;
 
   // Element content and order must be equal to each other
   auto current_array_position   = _gList_array .cbegin();
   auto current_vector_position  = _gList_vector.cbegin();
   auto current_dll_position     = _gList_dll   .cbegin();
   auto current_sll_position     = _gList_sll   .cbegin();
+  auto last_sll_position        = _gList_sll   .cbefore_begin();
+
+  std::uint64_t fingerprint = 0;
 
   auto end = _gList_vector.cend();
   while( current_vector_position != end )
@@ -365,13 +621,26 @@ bool GroceryList::containersAreConsistant() const
         || *current_array_position != *current_dll_position
         || *current_array_position != *current_sll_position ) return false;
 
+    // Every grocery item must be findable through the hash index, and lead back to its own position
+    std::size_t offset    = static_cast<std::size_t>( current_vector_position - _gList_vector.cbegin() );
+    auto        hashValue = GroceryItemSet::hash( *current_vector_position );
+    if( findOffset( *current_vector_position, hashValue ) != offset ) return false;
+    fingerprint += hashValue;
+
     // Advance the iterators to the next element in unison
     ++current_array_position;
     ++current_vector_position;
     ++current_dll_position;
-    ++current_sll_position;
+    last_sll_position = current_sll_position++;
   }
 
+  // The tracked singly linked list size and tail must agree with the actual nodes
+  if(    current_sll_position != _gList_sll.cend()
+      || last_sll_position    != _gList_sll_tail   ) return false;
+
+  // The fingerprint must be that of the grocery items actually held
+  if( fingerprint != _gList_fingerprint ) return false;
+
   return true;
 }
 
@@ -380,9 +649,34 @@ bool GroceryList::containersAreConsistant() const
 // gList_sll_size() const
 std::size_t GroceryList::gList_sll_size() const
 {
-  
-  return std::distance(_gList_sll.cbegin(), _gList_sll.cend());
-  
+  return _gList_sll_size;
+}
+
+
+
+// findOffset() const
+std::optional<std::size_t> GroceryList::findOffset( GroceryItem const & groceryItem, std::uint64_t hashValue ) const
+{
+  auto slot = _gList_index.find( hashValue, [&]( GroceryItemSet::Slot offset ) { return _gList_vector[offset] == groceryItem; } );
+  if( !slot )   return std::nullopt;
+  return *slot;
+}
+
+
+
+// reset()
+void GroceryList::reset() noexcept
+{
+  _gList_vector.clear();
+  _gList_dll   .clear();
+  _gList_sll   .clear();
+  _gList_index .clear();
+  for( auto & flags : _gList_flags )   flags.clear();
+
+  _gList_array_size = 0;
+  _gList_sll_size   = 0;
+  _gList_fingerprint = 0;
+  _gList_sll_tail   = _gList_sll.before_begin();
 }
 
 
@@ -404,6 +698,8 @@ std::size_t GroceryList::gList_sll_size() const
 // operator<<
 std::ostream & operator<<( std::ostream & stream, const GroceryList & groceryList )
 {
+  INSTRUMENT_SCOPE( LIST_INSERTION );
+
   if( !groceryList.containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
 
   // For each grocery item in the provided grocery list, insert the grocery item into the provided stream.  Each grocery item is
@@ -419,6 +715,8 @@ std::ostream & operator<<( std::ostream & stream, const GroceryList & groceryLis
 // operator>>
 std::istream & operator>>( std::istream & stream, GroceryList & groceryList )
 {
+  INSTRUMENT_SCOPE( LIST_EXTRACTION );
+
   if( !groceryList.containersAreConsistant() )   throw GroceryList::InvalidInternalState_Ex( "Container consistency error" exception_location );
 
  
@@ -3,14 +3,20 @@
 #include <array>
 #include <compare>                                                                            // weak_ordering
 #include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint64_t
 #include <forward_list>
 #include <initializer_list>
 #include <iostream>
 #include <list>
+#include <optional>
 #include <stdexcept>                                                                          // domain_error, length_error, logic_error
+#include <string_view>
 #include <vector>
 
+#include "BitSequence.hpp"
 #include "GroceryItem.hpp"
+#include "GroceryItemSet.hpp"
+#include "ProductSearchIndex.hpp"
 
 
 class GroceryList
@@ -22,26 +28,41 @@ class GroceryList
   public:
     // Types and Exceptions
     enum class Position {TOP, BOTTOM};
+    enum class Flag     {PURCHASED, ON_SALE, SUBSTITUTABLE, PRIORITY};                       // per grocery item markers, all clear when a grocery item is inserted
 
     struct InvalidInternalState_Ex : std::domain_error { using domain_error::domain_error; }; // Thrown if internal data structures become inconsistent with each other
     struct CapacityExceeded_Ex     : std::length_error { using length_error::length_error; }; // Thrown if more grocery items are inserted than will fit
-    struct InvalidOffset_Ex        : std::logic_error  { using logic_error ::logic_error;  }; // Thrown if inserting beyond current size
+    struct InvalidOffset_Ex        : std::logic_error  { using logic_error ::logic_error;  }; // Thrown if inserting beyond current size, or flagging at or beyond it
 
 
     // Constructors, destructor, and assignments
     //
-    // The compiler synthesized copy and move constructors, and copy and move assignment operators work just fine.  But since I also
-    // have user defined constructors, I need to explicitly say the compiler synthesized default constructor is also okay.
+    // The singly linked list's tail is remembered as an iterator, and a compiler synthesized copy would leave that iterator pointing
+    // into the source list.  So copy and move are user defined, and I need to explicitly say the compiler synthesized default
+    // constructor and destructor are also okay.
     GroceryList() = default;                                                                  // constructs an empty grocery list
     GroceryList( std::initializer_list<GroceryItem> const & initList );                       // constructs a grocery list from a braced list of grocery items
 
+    GroceryList            ( GroceryList const  & other );
+    GroceryList            ( GroceryList       && other ) noexcept;                           // leaves other as an empty grocery list
+    GroceryList & operator=( GroceryList const  & rhs   );
+    GroceryList & operator=( GroceryList       && rhs   ) noexcept;                           // leaves rhs as an empty grocery list
+   ~GroceryList            (                            ) = default;
+
 
     // Queries
-    std::size_t size() const;                                                                 // returns the number of grocery items in this grocery list
+    std::size_t size     (                                   ) const;                      // returns the number of grocery items in this grocery list
+    bool        isFlagged( std::size_t offsetFromTop, Flag flag ) const;                      // is the flag set on the grocery item at that offset?
+    std::size_t count    ( Flag flag, bool value = true          ) const;                      // number of grocery items whose flag is value, e.g. count( Flag::PURCHASED, false )
 
 
     // Accessors
-    std::size_t find( const GroceryItem & groceryItem ) const;                                // returns the grocery item's (zero-based) offset from top, size() if grocery item not found
+    std::size_t              find     ( const GroceryItem & groceryItem              ) const;   // returns the grocery item's (zero-based) offset from top, size() if grocery item not found
+    std::vector<std::size_t> search   ( std::string_view query, std::size_t k = 10 ) const;   // returns offsets of the k closest fuzzy matches on product and brand name, best first
+    std::vector<std::size_t> offsetsOf( Flag flag, bool value = true             ) const;   // returns, top to bottom, offsets of the grocery items whose flag is value
+
+    std::vector<GroceryItem>::const_iterator begin() const;                                   // read-only traversal from top to bottom over contiguous storage
+    std::vector<GroceryItem>::const_iterator end  () const;
 
 
     // Modifiers
@@ -53,26 +74,43 @@ class GroceryList
 
     void moveToTop( GroceryItem const & groceryItem                                       );  // finds then moves grocery item from its current position to the top of the grocery list
 
+    void setFlag  ( std::size_t offsetFromTop, Flag flag, bool value = true               );  // flags follow their grocery item as others are inserted, removed, or moved
+
     GroceryList & operator+=( std::initializer_list<GroceryItem> const & rhs );               // appends (aka concatenates) a braced list of grocery items to the end of this list
-    GroceryList & operator+=( GroceryList                        const & rhs );               // appends (aka concatenates) the rhs list to the bottom of this list
+    GroceryList & operator+=( GroceryList                        const & rhs );               // appends (aka concatenates) the rhs list, and its flags, to the bottom of this list
 
 
-    // Relational Operators
+    // Relational Operators.  Only the grocery items are compared, flags are not part of a grocery list's value.
     std::weak_ordering operator<=>( GroceryList const & rhs ) const;
     bool               operator== ( GroceryList const & rhs ) const;
 
 
   private:
+    static constexpr std::size_t FLAG_COUNT = 4;
+
     // Instance Attributes
     std::array       <GroceryItem, 11>  _gList_array;                                         // underlying containers holding grocery items
     std::vector      <GroceryItem    >  _gList_vector;                                        // operations performed on once container must be
     std::list        <GroceryItem    >  _gList_dll;                                           // replicated across all containers
     std::forward_list<GroceryItem    >  _gList_sll;
+    GroceryItemSet                      _gList_index;                                         // hashed identities of the grocery items (by offset), for find() and duplicate checks
+    std::array<BitSequence, FLAG_COUNT> _gList_flags;                                         // one bit per grocery item for each Flag, by offset, shifted in step with the containers
 
     std::size_t                         _gList_array_size = 0;                                // number of valid elements in _gList_array
+    std::size_t                         _gList_sll_size   = 0;                                // std::forward_list doesn't maintain its size, so track it here
+    std::uint64_t                       _gList_fingerprint = 0;                               // wrapping sum of the grocery items' hashes, order blind, so operator== can rule out most unequal lists at once
+    std::forward_list<GroceryItem>::iterator
+                                        _gList_sll_tail   = _gList_sll.before_begin();        // last node of _gList_sll, or before_begin() when empty
 
 
     // Helper member functions
     bool        containersAreConsistant() const;
-    std::size_t gList_sll_size         () const;                                              // std::forward_list doesn't maintain size, so calculate it on demand
+    std::size_t gList_sll_size         () const;                                              // std::forward_list doesn't maintain size, so it's tracked as elements are inserted and removed
+    void        reset                  ()       noexcept;                                     // empties all containers, used to leave a moved-from grocery list valid
+
+    BitSequence       & flagBits       ( Flag flag )       noexcept { return _gList_flags[static_cast<std::size_t>( flag )]; }
+    BitSequence const & flagBits       ( Flag flag ) const noexcept { return _gList_flags[static_cast<std::size_t>( flag )]; }
+
+    std::optional<std::size_t>
+                findOffset             ( GroceryItem const & groceryItem, std::uint64_t hashValue ) const;
 };
@@ -1,7 +1,10 @@
+#include <cstddef>                                                        // size_t
 #include <exception>
 #include <iomanip>                                                        // setprecision()
 #include <iostream>                                                       // boolalpha(), showpoint(), fixed()
 #include <string>                                                         // to_string()
+#include <utility>                                                        // move()
+#include <vector>
 
 #include "CheckResults.hpp"
 #include "GroceryItem.hpp"
@@ -47,6 +50,32 @@ namespace    // anonymous
       GroceryList list3 = { gItem_3, gItem_1, gItem_4, gItem_5 };
       affirm.is_less_than   ("Relational 1", list1, list3);
       affirm.is_greater_than("Relational 2", list3, list1);
+
+      GroceryList list4 = { gItem_2, gItem_3, gItem_5 };
+      affirm.is_less_than   ("Relational 3 - differs past first item", list1, list4);
+
+      GroceryList list5 = { gItem_2, gItem_3 };
+      affirm.is_less_than   ("Relational 4 - prefix orders first",     list5, list1);
+      affirm.is_not_equal   ("Relational 5 - prefix is not equal",     list5, list1);
+    }
+
+    {
+      GroceryList original = { gItem_1, gItem_2 };
+      GroceryList copy( original );
+      copy.insert( gItem_3, GroceryList::Position::BOTTOM );
+      affirm.is_equal( "Copy construction - independent bottom insert", GroceryList {gItem_1, gItem_2}, original );
+      affirm.is_equal( "Copy construction - bottom insert in copy",     GroceryList {gItem_1, gItem_2, gItem_3}, copy );
+
+      GroceryList moved( std::move( copy ) );
+      moved.insert( gItem_4, GroceryList::Position::BOTTOM );
+      moved.remove( 3 );
+      moved.insert( gItem_5, GroceryList::Position::BOTTOM );
+      affirm.is_equal( "Move construction - bottom insert after move",  GroceryList {gItem_1, gItem_2, gItem_3, gItem_5}, moved );
+
+      original = moved;
+      original.remove( gItem_5 );
+      original.insert( gItem_6, GroceryList::Position::BOTTOM );
+      affirm.is_equal( "Copy assignment - tail follows removal",        GroceryList {gItem_1, gItem_2, gItem_3, gItem_6}, original );
     }
 
     {
@@ -136,6 +165,51 @@ namespace    // anonymous
       affirm.is_equal( "Move to top", expected, list );
     }
 
+    {
+      GroceryList list = {gItem_1, gItem_2, gItem_3};
+
+      affirm.is_true ( "Equality - same length, different grocery items", !( list == GroceryList {gItem_1, gItem_2, gItem_4} ) );
+      affirm.is_true ( "Equality - same grocery items, different order",  !( list == GroceryList {gItem_3, gItem_2, gItem_1} ) );
+
+      list.insert( gItem_4, 1 );
+      list.remove( gItem_1    );
+      list.insert( gItem_1, 0 );
+      list.remove( gItem_4    );
+      affirm.is_equal( "Equality - after edits that cancel out", GroceryList {gItem_1, gItem_2, gItem_3}, list );
+    }
+
+    {
+      using Flag = GroceryList::Flag;
+      GroceryList list = {gItem_1, gItem_2, gItem_3, gItem_4, gItem_5};
+
+      list.setFlag( 1, Flag::ON_SALE   );                                   // gItem_2
+      list.setFlag( 3, Flag::ON_SALE   );                                   // gItem_4
+      list.setFlag( 3, Flag::PURCHASED );
+      list.setFlag( 4, Flag::PRIORITY  );                                   // gItem_5
+
+      list.insert   ( gItem_6, 2 );                                         // 1, 2, 6, 3, 4, 5
+      list.remove   ( gItem_1    );                                         // 2, 6, 3, 4, 5
+      list.moveToTop( gItem_5    );                                         // 5, 2, 6, 3, 4
+
+      affirm.is_true ( "Flags - follow insert, remove, and move", list.offsetsOf( Flag::ON_SALE ) == std::vector<std::size_t>{1, 4} );
+      affirm.is_true ( "Flags - moved grocery item keeps flag",   list.isFlagged( 0, Flag::PRIORITY )  &&  !list.isFlagged( 2, Flag::PRIORITY ) );
+      affirm.is_equal( "Flags - count unpurchased",               4U, list.count( Flag::PURCHASED, false ) );
+
+      GroceryList appended = {gItem_2, gItem_1};
+      appended += list;                                                     // 2, 1, 5, 6, 3, 4
+      affirm.is_true ( "Flags - appended with grocery items",     appended.offsetsOf( Flag::ON_SALE ) == std::vector<std::size_t>{5}  &&  appended.isFlagged( 2, Flag::PRIORITY ) );
+
+      try
+      {
+        list.setFlag( list.size(), Flag::SUBSTITUTABLE );
+        affirm.is_true( "Flags - bad offset", false );
+      }
+      catch( GroceryList::InvalidOffset_Ex const & )
+      {
+        affirm.is_true( "Flags - bad offset", true );
+      }
+    }
+
     {
       GroceryList list;
 
@@ -0,0 +1,198 @@
+#if defined( GROCERY_INSTRUMENTATION )                                              // nothing to compile otherwise
+
+#include <array>
+#include <atomic>
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint64_t
+#include <iomanip>                                                                  // setw(), left(), right()
+#include <iostream>
+#include <string_view>
+
+#include "Instrumentation.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  using Instrumentation::PROBE_COUNT;
+  using Instrumentation::ThreadCounters;
+  using Instrumentation::Totals;
+
+  constexpr std::array<std::string_view, PROBE_COUNT> PROBE_NAMES =
+  {
+    "GroceryList::GroceryList",   "GroceryList::copy",          "GroceryList::move",         "GroceryList::size",
+    "GroceryList::find",          "GroceryList::search",        "GroceryList::begin/end",    "GroceryList::insert",
+    "GroceryList::remove",        "GroceryList::moveToTop",     "GroceryList::operator+=",   "GroceryList::flags",
+    "GroceryList::operator<=>",   "GroceryList::operator==",    "GroceryList::operator<<",   "GroceryList::operator>>",
+    "GroceryList::containersAreConsistant",                     "GroceryList array shift (elements)",
+    "GroceryItem::copy",          "GroceryItem::move",          "GroceryItem::operator<=>",  "GroceryItem::operator=="
+  };
+
+  // The registry of live threads' counters, plus the totals of threads that have finished.  Everything here is constant
+  // initialized, so it's usable from other static initializers (the regression tests run during static initialization).  Threads
+  // come and go rarely, so a simple spin lock guards it.
+  constinit std::atomic_flag                    registryLock  = {};
+  constinit ThreadCounters *                    registryHead  = nullptr;
+  constinit std::array<Totals, PROBE_COUNT>     finished      = {};
+  constinit std::array<Totals, PROBE_COUNT>     baseline      = {};                 // subtracted from the totals, set by reset()
+
+
+  class RegistryGuard
+  {
+    public:
+      RegistryGuard() noexcept
+      {
+        while( registryLock.test_and_set( std::memory_order_acquire ) )   registryLock.wait( true, std::memory_order_relaxed );
+      }
+
+     ~RegistryGuard() noexcept
+      {
+        registryLock.clear( std::memory_order_release );
+        registryLock.notify_one();
+      }
+
+      RegistryGuard            ( RegistryGuard const & ) = delete;
+      RegistryGuard & operator=( RegistryGuard const & ) = delete;
+  };
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Instrumentation
+{
+  /*******************************************************************************
+  **  ThreadCounters
+  *******************************************************************************/
+
+  // Constructor
+  ThreadCounters::ThreadCounters() noexcept
+  {
+    RegistryGuard guard;
+
+    _next = registryHead;
+    if( registryHead != nullptr )   registryHead->_previous = this;
+    registryHead = this;
+  }
+
+
+
+  // Destructor
+  ThreadCounters::~ThreadCounters() noexcept
+  {
+    RegistryGuard guard;
+
+    for( std::size_t i = 0; i < PROBE_COUNT; ++i )
+    {
+      finished[i].calls  += _counters[i].calls .load( std::memory_order_relaxed );
+      finished[i].cycles += _counters[i].cycles.load( std::memory_order_relaxed );
+    }
+
+    if( _previous != nullptr )   _previous->_next = _next;
+    else                         registryHead     = _next;
+    if( _next     != nullptr )   _next->_previous = _previous;
+  }
+
+
+
+
+
+
+
+
+  /*******************************************************************************
+  **  Snapshots
+  *******************************************************************************/
+
+  // name()
+  std::string_view name( Probe probe ) noexcept
+  {
+    return PROBE_NAMES[static_cast<std::size_t>( probe )];
+  }
+
+
+
+  // snapshot()
+  Snapshot snapshot()
+  {
+    Snapshot result;
+    RegistryGuard guard;
+
+    result._totals = finished;
+    for( auto counters = registryHead;  counters != nullptr;  counters = counters->_next )
+    {
+      for( std::size_t i = 0; i < PROBE_COUNT; ++i )
+      {
+        result._totals[i].calls  += counters->_counters[i].calls .load( std::memory_order_relaxed );
+        result._totals[i].cycles += counters->_counters[i].cycles.load( std::memory_order_relaxed );
+      }
+    }
+
+    for( std::size_t i = 0; i < PROBE_COUNT; ++i )
+    {
+      result._totals[i].calls  -= baseline[i].calls;
+      result._totals[i].cycles -= baseline[i].cycles;
+    }
+    return result;
+  }
+
+
+
+  // reset()
+  void reset()
+  {
+    // Threads write their counters without locking, so rather than zero them underneath their owners remember where they stand now
+    auto now = snapshot();
+
+    RegistryGuard guard;
+    for( std::size_t i = 0; i < PROBE_COUNT; ++i )
+    {
+      baseline[i].calls  += now[static_cast<Probe>( i )].calls;
+      baseline[i].cycles += now[static_cast<Probe>( i )].cycles;
+    }
+  }
+
+
+
+  // writeText() const
+  void Snapshot::writeText( std::ostream & stream ) const
+  {
+    stream << std::left  << std::setw( 42 ) << "Probe"
+           << std::right << std::setw( 14 ) << "Calls" << std::setw( 18 ) << "Cycles" << std::setw( 14 ) << "Cycles/Call" << '\n';
+
+    for( std::size_t i = 0; i < PROBE_COUNT; ++i )
+    {
+      auto const & totals = _totals[i];
+      if( totals.calls == 0 )   continue;
+
+      stream << std::left  << std::setw( 42 ) << PROBE_NAMES[i] << std::right << std::setw( 14 ) << totals.calls;
+      if( totals.cycles != 0 )   stream << std::setw( 18 ) << totals.cycles << std::setw( 14 ) << totals.cycles / totals.calls;     // counted only probes leave these blank
+      stream << '\n';
+    }
+  }
+
+
+
+  // writeJson() const
+  void Snapshot::writeJson( std::ostream & stream ) const
+  {
+    // Probe names need no escaping, and every probe is listed so consumers see a fixed shape
+    stream << "{\n  \"probes\": [";
+    for( std::size_t i = 0; i < PROBE_COUNT; ++i )
+    {
+      stream << ( i == 0 ? "\n" : ",\n" )
+             << "    { \"name\": \"" << PROBE_NAMES[i] << "\", \"calls\": " << _totals[i].calls << ", \"cycles\": " << _totals[i].cycles << " }";
+    }
+    stream << "\n  ]\n}\n";
+  }
+}    // namespace Instrumentation
+
+#endif    // GROCERY_INSTRUMENTATION
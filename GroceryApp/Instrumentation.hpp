@@ -0,0 +1,141 @@
+#pragma once                                                                                  // include guard
+
+// Opt-in counters and cycle timers on the grocery list's hot paths.
+//
+// Build with -DGROCERY_INSTRUMENTATION to turn them on.  Otherwise INSTRUMENT_SCOPE() and INSTRUMENT_COUNT() expand to nothing and
+// none of the code below is compiled, so an uninstrumented build is exactly what it would be without this file.
+//
+// When on, each thread counts into its own block of counters (no locked instructions, no sharing of cache lines between threads),
+// and snapshot() adds up every thread's block, including threads that have since finished.  Timed probes record cycles from the
+// processor's time stamp counter where there is one (steady_clock nanoseconds otherwise), inclusive of any instrumented calls they
+// make.  reset() starts the totals over from zero.
+
+#if defined( GROCERY_INSTRUMENTATION )
+
+  #include <array>
+  #include <atomic>
+  #include <chrono>                                                                           // steady_clock
+  #include <cstddef>                                                                          // size_t
+  #include <cstdint>                                                                          // uint64_t
+  #include <iostream>
+  #include <string_view>
+
+  #if defined( __x86_64__ )  ||  defined( __i386__ )
+    #include <x86intrin.h>                                                                    // __rdtsc()
+  #endif
+
+
+
+  namespace Instrumentation
+  {
+    // Each probe names one instrumented operation.  Most are timed, and count calls.  Copies and moves (LIST_COPY, LIST_MOVE,
+    // ITEM_COPY, ITEM_MOVE) are counted but not timed, since a constructor's work is done before its body could start a timer.
+    // ARRAY_SHIFT counts grocery items shifted within GroceryList's array by insert() and remove().
+    enum class Probe : std::size_t
+    {
+      LIST_CONSTRUCT, LIST_COPY, LIST_MOVE, LIST_SIZE, LIST_FIND, LIST_SEARCH, LIST_BEGIN_END, LIST_INSERT, LIST_REMOVE,
+      LIST_MOVE_TO_TOP, LIST_APPEND, LIST_FLAGS, LIST_COMPARE, LIST_EQUAL, LIST_INSERTION, LIST_EXTRACTION, LIST_AUDIT,
+      ARRAY_SHIFT, ITEM_COPY, ITEM_MOVE, ITEM_COMPARE, ITEM_EQUAL
+    };
+
+    inline constexpr std::size_t PROBE_COUNT = static_cast<std::size_t>( Probe::ITEM_EQUAL ) + 1;
+
+    std::string_view name( Probe probe ) noexcept;                                            // e.g. "GroceryList::find"
+
+
+    struct Totals
+    {
+      std::uint64_t calls  = 0;
+      std::uint64_t cycles = 0;
+    };
+
+
+    // Totals across all threads as of the moment snapshot() was called
+    class Snapshot
+    {
+      public:
+        Totals const & operator[]( Probe probe ) const noexcept { return _totals[static_cast<std::size_t>( probe )]; }
+
+        void writeText( std::ostream & stream ) const;                                        // one line per probe that was used
+        void writeJson( std::ostream & stream ) const;                                        // { "probes": [ { "name": ..., "calls": ..., "cycles": ... }, ... ] }
+
+      private:
+        friend Snapshot snapshot();
+
+        std::array<Totals, PROBE_COUNT> _totals = {};
+    };
+
+    Snapshot snapshot();
+    void     reset   ();
+
+
+    // A thread's counters.  Only the owning thread writes them, so a plain load and store (rather than a locked increment) is
+    // enough, while the atomics let snapshot() read them from another thread.
+    class ThreadCounters
+    {
+      public:
+        ThreadCounters() noexcept;                                                            // links into the list snapshot() walks
+       ~ThreadCounters() noexcept;                                                            // folds this thread's totals into the finished threads' totals and unlinks
+
+        void add( Probe probe, std::uint64_t calls, std::uint64_t cycles ) noexcept
+        {
+          auto & counter = _counters[static_cast<std::size_t>( probe )];
+          counter.calls .store( counter.calls .load( std::memory_order_relaxed ) + calls,  std::memory_order_relaxed );
+          counter.cycles.store( counter.cycles.load( std::memory_order_relaxed ) + cycles, std::memory_order_relaxed );
+        }
+
+      private:
+        friend Snapshot snapshot();
+
+        struct Counter
+        {
+          std::atomic<std::uint64_t> calls  = 0;
+          std::atomic<std::uint64_t> cycles = 0;
+        };
+
+        std::array<Counter, PROBE_COUNT> _counters;
+        ThreadCounters *                 _previous = nullptr;
+        ThreadCounters *                 _next     = nullptr;
+    };
+
+    inline thread_local ThreadCounters threadCounters;
+
+
+
+    inline std::uint64_t cycles() noexcept
+    {
+      #if defined( __x86_64__ )  ||  defined( __i386__ )
+        return __rdtsc();
+      #else
+        return static_cast<std::uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+      #endif
+    }
+
+
+
+    // Counts one call and the cycles spent until the end of the enclosing scope
+    class ScopedTimer
+    {
+      public:
+        explicit ScopedTimer( Probe probe ) noexcept : _probe( probe ), _start( cycles() ) {}
+       ~ScopedTimer() noexcept { threadCounters.add( _probe, 1, cycles() - _start ); }
+
+        ScopedTimer            ( ScopedTimer const & ) = delete;
+        ScopedTimer & operator=( ScopedTimer const & ) = delete;
+
+      private:
+        Probe         _probe;
+        std::uint64_t _start;
+    };
+  }    // namespace Instrumentation
+
+
+  #define INSTRUMENT_SCOPE( probe )          Instrumentation::ScopedTimer instrumentedScope( Instrumentation::Probe::probe )
+  #define INSTRUMENT_COUNT( probe, calls )   Instrumentation::threadCounters.add( Instrumentation::Probe::probe, ( calls ), 0 )
+
+#else
+
+  #define INSTRUMENT_SCOPE( probe )          static_cast<void>( 0 )
+  #define INSTRUMENT_COUNT( probe, calls )   static_cast<void>( 0 )
+
+#endif
@@ -0,0 +1,93 @@
+#if defined( GROCERY_INSTRUMENTATION )                                    // the instrumentation, and so its tests, exist only when asked for
+
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "Instrumentation.hpp"
+
+
+
+namespace    // anonymous
+{
+  class InstrumentationRegressionTest
+  {
+    public:
+      InstrumentationRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_instrumentation_tests;
+
+
+
+
+  void InstrumentationRegressionTest::test()
+  {
+    using Instrumentation::Probe;
+
+    Instrumentation::reset();
+    affirm.is_equal( "Reset:  Totals start over", 0ULL, static_cast<unsigned long long>( Instrumentation::snapshot()[Probe::LIST_INSERT].calls ) );
+
+    GroceryList list = { { "milk" }, { "eggs" }, { "bread" } };
+    list.insert( { "butter" }, 0 );                                       // shifts the three grocery items already there
+    list.find  ( { "eggs"   }    );
+    list.find  ( { "jam"    }    );
+    list.remove( 3 );                                                     // the bottom grocery item, nothing shifts
+
+    GroceryItem copy = *list.begin();
+
+    auto snapshot = Instrumentation::snapshot();
+    affirm.is_equal( "List:  Constructions",       1ULL, static_cast<unsigned long long>( snapshot[Probe::LIST_CONSTRUCT].calls ) );
+    affirm.is_equal( "List:  Inserts",             4ULL, static_cast<unsigned long long>( snapshot[Probe::LIST_INSERT   ].calls ) );
+    affirm.is_equal( "List:  Finds",               2ULL, static_cast<unsigned long long>( snapshot[Probe::LIST_FIND     ].calls ) );
+    affirm.is_equal( "List:  Removes",             1ULL, static_cast<unsigned long long>( snapshot[Probe::LIST_REMOVE   ].calls ) );
+    affirm.is_equal( "List:  Array shifts",        3ULL, static_cast<unsigned long long>( snapshot[Probe::ARRAY_SHIFT   ].calls ) );
+    affirm.is_true ( "List:  Audits counted",      snapshot[Probe::LIST_AUDIT].calls > 0 );
+    affirm.is_true ( "Item:  Copies counted",      snapshot[Probe::ITEM_COPY ].calls > 0  &&  snapshot[Probe::ITEM_COPY].cycles == 0 );
+    affirm.is_true ( "Timers:  Cycles recorded",   snapshot[Probe::LIST_CONSTRUCT].cycles > 0 );
+
+    // A finished thread's counts are kept
+    std::thread( [&] { for( unsigned i = 0; i < 100; ++i )   list.find( copy ); } ).join();
+    affirm.is_equal( "Threads:  Finished thread folded in", 102ULL, static_cast<unsigned long long>( Instrumentation::snapshot()[Probe::LIST_FIND].calls ) );
+
+    std::ostringstream text, json;
+    snapshot.writeText( text );
+    snapshot.writeJson( json );
+    affirm.is_true( "Export:  Text",  text.str().find( "GroceryList::find" ) != std::string::npos );
+    affirm.is_true( "Export:  JSON",  json.str().find( "{ \"name\": \"GroceryList::insert\", \"calls\": 4, \"cycles\": " ) != std::string::npos );
+  }
+
+
+
+
+  InstrumentationRegressionTest::InstrumentationRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nInstrumentation Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nInstrumentation Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"namespace Instrumentation\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
+
+#endif    // GROCERY_INSTRUMENTATION
@@ -0,0 +1,206 @@
+#include <algorithm>                                                                // max(), min()
+#include <cmath>                                                                    // llround()
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint32_t, uint64_t
+#include <functional>                                                               // hash<>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>                                                                  // swap()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+
+/*******************************************************************************
+**  Promotion
+*******************************************************************************/
+
+// discountOn() const
+PriceCatalog::Cents PriceCatalog::Promotion::discountOn( Cents price ) const noexcept
+{
+  Cents discount = kind == Kind::PERCENT_OFF  ?  price * value / 10'000  :  value;
+  return std::min( discount, price );
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Static member functions
+*******************************************************************************/
+
+// toCents()
+PriceCatalog::Cents PriceCatalog::toCents( double dollars ) noexcept
+{
+  return static_cast<Cents>( std::llround( dollars * 100.0 ) );
+}
+
+
+
+// hash()
+std::uint64_t PriceCatalog::hash( std::string_view upcCode ) noexcept
+{
+  // The table uses the low bits for the bucket, so stir the high bits down (Fibonacci hashing)
+  std::uint64_t value = std::hash<std::string_view>{}( upcCode ) * 0x9E3779B97F4A7C15ULL;
+  return value ^ ( value >> 32 );
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Constructors
+*******************************************************************************/
+
+// Initializer List Constructor
+PriceCatalog::PriceCatalog( std::initializer_list<GroceryItem> const & items )
+{
+  for( auto && groceryItem : items )   add( groceryItem );
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Accessors
+*******************************************************************************/
+
+// find() const
+PriceCatalog::EntryID PriceCatalog::find( std::string_view upcCode ) const noexcept
+{
+  return find( upcCode, hash( upcCode ) );
+}
+
+
+
+// find( hash ) const
+PriceCatalog::EntryID PriceCatalog::find( std::string_view upcCode, std::uint64_t hashValue ) const noexcept
+{
+  if( _tableEntries.empty() )   return NOT_FOUND;
+
+  // Compare full hashes first, so the UPC string is only compared when it's almost certainly a match
+  auto const mask = _tableEntries.size() - 1;
+  for( auto bucket = hashValue & mask;  _tableEntries[bucket] != NOT_FOUND;  bucket = ( bucket + 1 ) & mask )
+  {
+    if( _tableHashes[bucket] == hashValue  &&  _upcCodes[_tableEntries[bucket]] == upcCode )   return _tableEntries[bucket];
+  }
+  return NOT_FOUND;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Modifiers
+*******************************************************************************/
+
+// add()
+PriceCatalog::EntryID PriceCatalog::add( GroceryItem const & groceryItem )
+{
+  auto const hashValue = hash( groceryItem.upcCode() );
+
+  if( auto entry = find( groceryItem.upcCode(), hashValue );  entry != NOT_FOUND )
+  {
+    _prices  [entry] = toCents( groceryItem.price() );
+    _brandIDs[entry] = brandID( groceryItem.brandName() );
+    return entry;
+  }
+
+  if( ( _upcCodes.size() + 1 ) * 2 > _tableEntries.size() )   grow();
+
+  auto const entry = static_cast<EntryID>( _upcCodes.size() );
+  _upcCodes      .push_back( groceryItem.upcCode() );
+  _prices        .push_back( toCents( groceryItem.price() ) );
+  _brandIDs      .push_back( brandID( groceryItem.brandName() ) );
+  _itemPromotions.push_back( {} );
+
+  auto const mask   = _tableEntries.size() - 1;
+  auto       bucket = hashValue & mask;
+  while( _tableEntries[bucket] != NOT_FOUND )   bucket = ( bucket + 1 ) & mask;
+  _tableHashes [bucket] = hashValue;
+  _tableEntries[bucket] = entry;
+
+  return entry;
+}
+
+
+
+// addItemPromotion()
+void PriceCatalog::addItemPromotion( std::string_view upcCode, Promotion promotion )
+{
+  if( auto entry = find( upcCode );  entry != NOT_FOUND )   _itemPromotions[entry] = promotion;
+}
+
+
+
+// addBrandPromotion()
+void PriceCatalog::addBrandPromotion( std::string const & brandName, Promotion promotion )
+{
+  _brandPromotions[brandID( brandName )] = promotion;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Private member functions
+*******************************************************************************/
+
+// brandID()
+std::uint32_t PriceCatalog::brandID( std::string const & brandName )
+{
+  auto [position, inserted] = _brandIDsByName.try_emplace( brandName, static_cast<std::uint32_t>( _brandNames.size() ) );
+  if( inserted )
+  {
+    _brandNames     .push_back( brandName );
+    _brandPromotions.push_back( {} );
+  }
+  return position->second;
+}
+
+
+
+// grow()
+void PriceCatalog::grow()
+{
+  std::vector<std::uint64_t> hashes ( std::max<std::size_t>( 16, _tableEntries.size() * 2 ) );
+  std::vector<EntryID>       entries( hashes.size(), NOT_FOUND );
+
+  auto const mask = entries.size() - 1;
+  for( std::size_t oldBucket = 0; oldBucket < _tableEntries.size(); ++oldBucket )
+  {
+    if( _tableEntries[oldBucket] == NOT_FOUND )   continue;
+
+    auto bucket = _tableHashes[oldBucket] & mask;
+    while( entries[bucket] != NOT_FOUND )   bucket = ( bucket + 1 ) & mask;
+    hashes [bucket] = _tableHashes [oldBucket];
+    entries[bucket] = _tableEntries[oldBucket];
+  }
+
+  std::swap( hashes,  _tableHashes  );
+  std::swap( entries, _tableEntries );
+}
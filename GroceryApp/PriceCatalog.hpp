@@ -0,0 +1,87 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // int64_t, uint32_t, uint64_t
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "GroceryItem.hpp"
+
+
+
+
+// Stores prices and promotions keyed by UPC code, used to price grocery items at checkout.
+//
+// Money is held in fixed-point cents so totals add exactly.  Entries are kept in parallel columns (structure of arrays) and found
+// through an open-addressed table of UPC hashes, so a checkout can look up a whole batch of UPC codes in one tight loop.
+class PriceCatalog
+{
+  public:
+    // Types and Exceptions
+    using Cents   = std::int64_t;
+    using EntryID = std::uint32_t;
+
+    static constexpr EntryID NOT_FOUND = static_cast<EntryID>( -1 );
+
+    struct Promotion
+    {
+      enum class Kind { PERCENT_OFF, AMOUNT_OFF };
+
+      Kind  kind  = Kind::AMOUNT_OFF;
+      Cents value = 0;                                                                        // basis points (1/100 of a percent) for PERCENT_OFF, cents for AMOUNT_OFF
+
+      Cents discountOn( Cents price ) const noexcept;                                         // never more than the price itself
+    };
+
+    static Cents         toCents( double        dollars ) noexcept;                          // rounds to the nearest cent
+    static std::uint64_t hash   ( std::string_view upcCode ) noexcept;
+
+
+    // Constructors
+    PriceCatalog() = default;
+    PriceCatalog( std::initializer_list<GroceryItem> const & items );
+
+
+    // Queries
+    std::size_t size() const noexcept { return _upcCodes.size(); }
+
+
+    // Accessors
+    EntryID             find          ( std::string_view upcCode                          ) const noexcept;  // returns NOT_FOUND if the UPC code isn't in the catalog
+    EntryID             find          ( std::string_view upcCode, std::uint64_t hashValue ) const noexcept;  // same, with the UPC code's hash already computed
+
+    std::string const & upcCode       ( EntryID entry ) const noexcept { return _upcCodes[entry]; }
+    Cents               price         ( EntryID entry ) const noexcept { return _prices[entry]; }
+    std::string const & brandName     ( EntryID entry ) const noexcept { return _brandNames[_brandIDs[entry]]; }
+    Promotion const &   itemPromotion ( EntryID entry ) const noexcept { return _itemPromotions[entry]; }
+    Promotion const &   brandPromotion( EntryID entry ) const noexcept { return _brandPromotions[_brandIDs[entry]]; }
+
+
+    // Modifiers
+    EntryID add              ( GroceryItem const & groceryItem );                             // adds the grocery item's price, or replaces it if the UPC code is already present
+    void    addItemPromotion ( std::string_view upcCode,   Promotion promotion );             // replaces any promotion on that UPC code, ignored if the UPC code isn't in the catalog
+    void    addBrandPromotion( std::string const & brandName, Promotion promotion );          // replaces any promotion on that brand, applies to catalog entries added before or after
+
+
+  private:
+    // Instance Attributes
+    std::vector<std::string>   _upcCodes;                                                     // entry columns, indexed by EntryID
+    std::vector<Cents>         _prices;
+    std::vector<std::uint32_t> _brandIDs;
+    std::vector<Promotion>     _itemPromotions;
+
+    std::vector<std::string>                       _brandNames;                               // brand columns, indexed by brand ID
+    std::vector<Promotion>                         _brandPromotions;
+    std::unordered_map<std::string, std::uint32_t> _brandIDsByName;
+
+    std::vector<std::uint64_t> _tableHashes;                                                  // open-addressed UPC table, linear probing, at most half full
+    std::vector<EntryID>       _tableEntries;                                                 // NOT_FOUND marks an empty bucket
+
+
+    // Helper member functions
+    std::uint32_t brandID( std::string const & brandName );                                   // finds or creates the brand's ID
+    void          grow   ();
+};
@@ -0,0 +1,371 @@
+#include <algorithm>                                                                // min(), max(), push_heap(), pop_heap(), sort()
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // int32_t, uint32_t, uint64_t
+#include <limits>                                                                   // numeric_limits
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>                                                                  // swap()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "PriceCatalog.hpp"
+#include "PriceHistory.hpp"
+
+
+
+
+#define exception_location "\n detected in function \"" + std::string(__func__) +  "\""    \
+                           "\n at line " + std::to_string( __LINE__ ) +                    \
+                           "\n in file \"" __FILE__ "\""
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  constexpr PriceHistory::Cents magnitude( PriceHistory::Cents change ) noexcept
+  {
+    return change < 0  ?  -change  :  change;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Private member function templates
+*******************************************************************************/
+
+// forEachPoint() const
+template<typename Visitor>
+void PriceHistory::forEachPoint( BlockID block, Visitor && visit ) const
+{
+  // Rebuilds each change from the block's first time and price by running sums over the delta columns
+  Timestamp time  = _blockFirstTime [block];
+  Cents     price = _blockFirstPrice[block];
+  visit( time, price );
+
+  auto const first = _blockDeltas[block];
+  for( std::size_t i = 1; i < _blockCount[block]; ++i )
+  {
+    time  += _timeDeltas [first + i - 1];
+    price += _priceDeltas[first + i - 1];
+    visit( time, price );
+  }
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Accessors
+*******************************************************************************/
+
+// priceAt() const
+std::optional<PriceHistory::Cents> PriceHistory::priceAt( std::string_view upcCode, Timestamp when ) const
+{
+  auto const series = find( upcCode, PriceCatalog::hash( upcCode ) );
+  if( series == NONE )   return std::nullopt;
+
+  // Most lookups are for recent times, so walk back from the newest block to the one in effect at that time
+  auto block = _seriesLastBlock[series];
+  while( block != NONE  &&  _blockFirstTime[block] > when )   block = _blockPrevious[block];
+
+  if( block == NONE                    )   return std::nullopt;                      // before the first recorded price
+  if( _blockLastTime[block] <= when    )   return _blockLastPrice[block];            // the block's summary answers without decoding
+
+  Cents price = _blockFirstPrice[block];
+  forEachPoint( block, [&]( Timestamp time, Cents value ) { if( time <= when )   price = value; } );
+  return price;
+}
+
+
+
+// minOver() const
+std::optional<PriceHistory::Cents> PriceHistory::minOver( std::string_view upcCode, Timestamp from, Timestamp to ) const
+{
+  auto const series = find( upcCode, PriceCatalog::hash( upcCode ) );
+  if( series == NONE  ||  from > to )   return std::nullopt;
+
+  // The prices in effect during [from, to] are the one current at from plus every change made after from, up to to.  Blocks wholly
+  // inside the window contribute their summary minimum, and only the blocks straddling its edges are decoded.
+  std::optional<Cents> lowest;
+  auto consider = [&]( Cents price ) { lowest = lowest  ?  std::min( *lowest, price )  :  price; };
+
+  for( auto block = _seriesLastBlock[series];  block != NONE;  block = _blockPrevious[block] )
+  {
+    if( _blockFirstTime[block] > to   )   continue;                                  // entirely after the window
+    if( _blockLastTime [block] <= from )   { consider( _blockLastPrice[block] );  break; }   // entirely before, so its last price is the one current at from
+
+    if( _blockFirstTime[block] > from  &&  _blockLastTime[block] <= to )
+    {
+      consider( _blockMinPrice[block] );
+      continue;
+    }
+
+    std::optional<Cents> currentAtFrom;
+    forEachPoint( block, [&]( Timestamp time, Cents price )
+                         {
+                           if     ( time <= from )   currentAtFrom = price;
+                           else if( time <= to   )   consider( price );
+                         } );
+
+    if( currentAtFrom )                                                             // this block holds the price current at from, so nothing earlier matters
+    {
+      consider( *currentAtFrom );
+      break;
+    }
+  }
+  return lowest;
+}
+
+
+
+// biggestChanges() const
+std::vector<PriceHistory::Change> PriceHistory::biggestChanges( std::size_t k, Timestamp from, Timestamp to ) const
+{
+  struct Candidate
+  {
+    Cents     amount;
+    Timestamp when;
+    Cents     from;
+    Cents     to;
+    SeriesID  series;
+
+    bool operator<( Candidate const & rhs ) const noexcept                          // ranks larger changes, then earlier ones, first
+    {
+      if( amount != rhs.amount )   return amount > rhs.amount;
+      if( when   != rhs.when   )   return when   < rhs.when;
+      return series < rhs.series;
+    }
+  };
+
+  // Keep the best k seen so far in a heap whose top is the weakest of them.  Once the heap is full, a block whose largest change
+  // can't beat the weakest is skipped on its summary alone, so most blocks are never decoded.
+  if( k == 0 )   return {};
+  std::vector<Candidate> best;
+
+  for( BlockID block = 0; block < _blockCount.size(); ++block )
+  {
+    if( _blockFirstTime[block] > to  ||  _blockLastTime[block] < from )   continue;
+    if( best.size() == k  &&  _blockMaxChange[block] < best.front().amount )   continue;
+
+    auto const previousBlock = _blockPrevious[block];
+    bool       hasPrevious   = previousBlock != NONE;
+    Cents      previous      = hasPrevious  ?  _blockLastPrice[previousBlock]  :  0;
+
+    forEachPoint( block, [&]( Timestamp time, Cents price )
+                         {
+                           if( hasPrevious  &&  time >= from  &&  time <= to )
+                           {
+                             Candidate candidate = { magnitude( price - previous ), time, previous, price, _blockSeries[block] };
+                             if( best.size() < k )
+                             {
+                               best.push_back( candidate );
+                               std::push_heap( best.begin(), best.end() );
+                             }
+                             else if( candidate < best.front() )
+                             {
+                               std::pop_heap( best.begin(), best.end() );
+                               best.back() = candidate;
+                               std::push_heap( best.begin(), best.end() );
+                             }
+                           }
+                           previous    = price;
+                           hasPrevious = true;
+                         } );
+  }
+
+  std::sort( best.begin(), best.end() );
+
+  std::vector<Change> result;
+  result.reserve( best.size() );
+  for( auto && candidate : best )   result.push_back( { _upcCodes[candidate.series], candidate.when, candidate.from, candidate.to } );
+  return result;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Modifiers
+*******************************************************************************/
+
+// record( upcCode )
+bool PriceHistory::record( std::string_view upcCode, Timestamp when, Cents price )
+{
+  auto const hashValue = PriceCatalog::hash( upcCode );
+  auto       series    = find( upcCode, hashValue );
+
+  if( series == NONE )
+  {
+    series = addSeries( upcCode, hashValue );
+    _seriesLastBlock[series] = addBlock( series, when, price, 0 );
+    ++_pointCount;
+    return true;
+  }
+
+  auto const block = _seriesLastBlock[series];
+  if( when  < _blockLastTime [block] )   throw OutOfOrder_Ex( "Price recorded earlier than the UPC code's latest" exception_location );
+  if( price == _blockLastPrice[block] )   return false;
+
+  auto const timeDelta  = static_cast<std::uint64_t>( when - _blockLastTime[block] );
+  auto const priceDelta = price - _blockLastPrice[block];
+
+  // Start a new block when this one is full, or the change won't fit the delta columns' fixed widths
+  if(    _blockCount[block] == BLOCK_POINTS
+      || timeDelta  > std::numeric_limits<std::uint32_t>::max()
+      || priceDelta > std::numeric_limits<std::int32_t >::max()
+      || priceDelta < std::numeric_limits<std::int32_t >::min() )
+  {
+    auto const next = addBlock( series, when, price, magnitude( priceDelta ) );
+    _blockPrevious  [next]   = block;
+    _seriesLastBlock[series] = next;
+    ++_pointCount;
+    return true;
+  }
+
+  if( _blockDeltas[block] == NONE )
+  {
+    _blockDeltas[block] = static_cast<std::uint32_t>( _timeDeltas.size() );
+    _timeDeltas .resize( _timeDeltas .size() + BLOCK_POINTS - 1 );
+    _priceDeltas.resize( _priceDeltas.size() + BLOCK_POINTS - 1 );
+  }
+
+  auto const slot = _blockDeltas[block] + _blockCount[block] - 1;
+  _timeDeltas [slot] = static_cast<std::uint32_t>( timeDelta  );
+  _priceDeltas[slot] = static_cast<std::int32_t >( priceDelta );
+
+  ++_blockCount[block];
+  _blockLastTime [block] = when;
+  _blockLastPrice[block] = price;
+  _blockMinPrice [block] = std::min( _blockMinPrice [block], price );
+  _blockMaxChange[block] = std::max( _blockMaxChange[block], magnitude( priceDelta ) );
+
+  ++_pointCount;
+  return true;
+}
+
+
+
+// record( groceryItem )
+bool PriceHistory::record( GroceryItem const & groceryItem, Timestamp when )
+{
+  return record( groceryItem.upcCode(), when, PriceCatalog::toCents( groceryItem.price() ) );
+}
+
+
+
+// record( catalog )
+std::size_t PriceHistory::record( PriceCatalog const & catalog, Timestamp when )
+{
+  std::size_t changed = 0;
+  for( PriceCatalog::EntryID entry = 0; entry < catalog.size(); ++entry )
+  {
+    if( record( catalog.upcCode( entry ), when, catalog.price( entry ) ) )   ++changed;
+  }
+  return changed;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Private member functions
+*******************************************************************************/
+
+// find() const
+PriceHistory::SeriesID PriceHistory::find( std::string_view upcCode, std::uint64_t hashValue ) const noexcept
+{
+  if( _tableSeries.empty() )   return NONE;
+
+  // Compare full hashes first, so the UPC string is only compared when it's almost certainly a match
+  auto const mask = _tableSeries.size() - 1;
+  for( auto bucket = hashValue & mask;  _tableSeries[bucket] != NONE;  bucket = ( bucket + 1 ) & mask )
+  {
+    if( _tableHashes[bucket] == hashValue  &&  _upcCodes[_tableSeries[bucket]] == upcCode )   return _tableSeries[bucket];
+  }
+  return NONE;
+}
+
+
+
+// addSeries()
+PriceHistory::SeriesID PriceHistory::addSeries( std::string_view upcCode, std::uint64_t hashValue )
+{
+  if( ( _upcCodes.size() + 1 ) * 2 > _tableSeries.size() )   grow();
+
+  auto const series = static_cast<SeriesID>( _upcCodes.size() );
+  _upcCodes       .emplace_back( upcCode );
+  _seriesLastBlock.push_back   ( NONE    );
+
+  auto const mask   = _tableSeries.size() - 1;
+  auto       bucket = hashValue & mask;
+  while( _tableSeries[bucket] != NONE )   bucket = ( bucket + 1 ) & mask;
+  _tableHashes[bucket] = hashValue;
+  _tableSeries[bucket] = series;
+
+  return series;
+}
+
+
+
+// addBlock()
+PriceHistory::BlockID PriceHistory::addBlock( SeriesID series, Timestamp when, Cents price, Cents change )
+{
+  auto const block = static_cast<BlockID>( _blockCount.size() );
+  _blockFirstTime .push_back( when   );
+  _blockLastTime  .push_back( when   );
+  _blockFirstPrice.push_back( price  );
+  _blockLastPrice .push_back( price  );
+  _blockMinPrice  .push_back( price  );
+  _blockMaxChange .push_back( change );
+  _blockPrevious  .push_back( NONE   );
+  _blockSeries    .push_back( series );
+  _blockDeltas    .push_back( NONE   );
+  _blockCount     .push_back( 1      );
+  return block;
+}
+
+
+
+// grow()
+void PriceHistory::grow()
+{
+  std::vector<std::uint64_t> hashes( std::max<std::size_t>( 16, _tableSeries.size() * 2 ) );
+  std::vector<SeriesID>      series( hashes.size(), NONE );
+
+  auto const mask = series.size() - 1;
+  for( std::size_t oldBucket = 0; oldBucket < _tableSeries.size(); ++oldBucket )
+  {
+    if( _tableSeries[oldBucket] == NONE )   continue;
+
+    auto bucket = _tableHashes[oldBucket] & mask;
+    while( series[bucket] != NONE )   bucket = ( bucket + 1 ) & mask;
+    hashes[bucket] = _tableHashes[oldBucket];
+    series[bucket] = _tableSeries[oldBucket];
+  }
+
+  std::swap( hashes, _tableHashes );
+  std::swap( series, _tableSeries );
+}
+
@@ -0,0 +1,108 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // int32_t, int64_t, uint8_t, uint32_t, uint64_t
+#include <limits>                                                                             // numeric_limits
+#include <optional>
+#include <stdexcept>                                                                          // invalid_argument
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "PriceCatalog.hpp"
+
+
+
+
+// An append-only record of every price each UPC code has had, and when it changed.
+//
+// Each UPC code's history is a chain of blocks of up to BLOCK_POINTS price changes.  A block keeps its first time and price in
+// full, and the rest as small fixed-width deltas from the change before (time and price deltas in separate columns), so a price
+// change costs 8 bytes instead of 16.  Delta storage is only allocated when a block gets its second change, so the common case of a
+// UPC code recorded once at a catalog load costs no more than a block's summary.  Each block's summary (first and last time and
+// price, lowest price, largest change) is itself a set of parallel columns, so most queries answer whole blocks from their summary
+// and decode only the block or two at the edges of a time window.  Recording a price equal to the UPC code's current price stores
+// nothing.
+//
+// Timestamps are whatever clock the caller uses (e.g. seconds since the epoch), as long as each UPC code's are recorded in
+// non-decreasing order.
+class PriceHistory
+{
+  public:
+    // Types and Exceptions
+    using Cents     = PriceCatalog::Cents;
+    using Timestamp = std::int64_t;
+
+    struct OutOfOrder_Ex : std::invalid_argument { using invalid_argument::invalid_argument; };  // Thrown if a price is recorded earlier than the UPC code's latest
+
+    struct Change
+    {
+      std::string upcCode;
+      Timestamp   when = 0;
+      Cents       from = 0;
+      Cents       to   = 0;
+    };
+
+    static constexpr std::size_t BLOCK_POINTS = 16;
+
+
+    // Queries
+    std::size_t size      () const noexcept { return _upcCodes.size(); }                      // number of UPC codes with a history
+    std::size_t pointCount() const noexcept { return _pointCount;      }                      // number of price changes recorded, across all UPC codes
+
+
+    // Accessors
+    std::optional<Cents> priceAt       ( std::string_view upcCode, Timestamp when               ) const;  // the price in effect at that time, nothing if none was recorded by then
+    std::optional<Cents> minOver       ( std::string_view upcCode, Timestamp from, Timestamp to ) const;  // the lowest price in effect at any time in [from, to]
+
+    std::vector<Change>  biggestChanges( std::size_t k,                                                  // the k largest price changes (by amount) in [from, to], largest first
+                                         Timestamp   from = std::numeric_limits<Timestamp>::min(),
+                                         Timestamp   to   = std::numeric_limits<Timestamp>::max() ) const;
+
+
+    // Modifiers
+    bool        record( std::string_view     upcCode,     Timestamp when, Cents price );      // returns false if the price was already current, so nothing was stored
+    bool        record( GroceryItem  const & groceryItem, Timestamp when              );      // records the grocery item's current price
+    std::size_t record( PriceCatalog const & catalog,     Timestamp when              );      // records every catalog price, returns how many changed
+
+
+  private:
+    using SeriesID = std::uint32_t;
+    using BlockID  = std::uint32_t;
+
+    static constexpr std::uint32_t NONE = static_cast<std::uint32_t>( -1 );
+
+    // Instance Attributes
+    std::vector<std::string>   _upcCodes;                                                     // series columns, indexed by SeriesID
+    std::vector<BlockID>       _seriesLastBlock;
+
+    std::vector<Timestamp>     _blockFirstTime;                                               // block summary columns, indexed by BlockID
+    std::vector<Timestamp>     _blockLastTime;
+    std::vector<Cents>         _blockFirstPrice;
+    std::vector<Cents>         _blockLastPrice;
+    std::vector<Cents>         _blockMinPrice;
+    std::vector<Cents>         _blockMaxChange;                                               // largest change into any of the block's prices, including its first
+    std::vector<BlockID>       _blockPrevious;                                                // the same UPC code's earlier block, NONE for its first
+    std::vector<SeriesID>      _blockSeries;
+    std::vector<std::uint32_t> _blockDeltas;                                                  // first delta slot, NONE until the block's second price change
+    std::vector<std::uint8_t>  _blockCount;                                                   // price changes in the block, 1 to BLOCK_POINTS
+
+    std::vector<std::uint32_t> _timeDeltas;                                                   // delta columns, BLOCK_POINTS - 1 slots per block that has any
+    std::vector<std::int32_t>  _priceDeltas;
+
+    std::vector<std::uint64_t> _tableHashes;                                                  // open-addressed UPC table, linear probing, at most half full
+    std::vector<SeriesID>      _tableSeries;                                                  // NONE marks an empty bucket
+
+    std::size_t                _pointCount = 0;
+
+
+    // Helper member functions
+    SeriesID find     ( std::string_view upcCode, std::uint64_t hashValue ) const noexcept;
+    SeriesID addSeries( std::string_view upcCode, std::uint64_t hashValue );
+    BlockID  addBlock ( SeriesID series, Timestamp when, Cents price, Cents change );
+    void     grow     ();
+
+    template<typename Visitor>                                                                // Visitor:  void( Timestamp when, Cents price )
+    void     forEachPoint( BlockID block, Visitor && visit ) const;
+};
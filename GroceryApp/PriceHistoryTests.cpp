@@ -0,0 +1,165 @@
+#include <algorithm>                                                      // min(), sort()
+#include <cstddef>                                                        // size_t
+#include <cstdint>                                                        // int64_t
+#include <cstdlib>                                                        // abs()
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <optional>
+#include <random>
+#include <string>                                                         // to_string()
+#include <utility>                                                        // pair
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "PriceCatalog.hpp"
+#include "PriceHistory.hpp"
+
+
+
+namespace    // anonymous
+{
+  class PriceHistoryRegressionTest
+  {
+    public:
+      PriceHistoryRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_price_history_tests;
+
+
+
+
+  void PriceHistoryRegressionTest::test()
+  {
+    using Cents = PriceHistory::Cents;
+
+    {
+      PriceHistory history;
+      history.record( "001", 100, 399 );
+      history.record( "001", 200, 349 );
+      history.record( "001", 300, 349 );                                    // unchanged, not stored
+      history.record( "001", 400, 429 );
+
+      affirm.is_equal( "Basics:  Changes stored",        3U,   history.pointCount() );
+      affirm.is_true ( "Basics:  Before first price",    !history.priceAt( "001", 99 ) );
+      affirm.is_true ( "Basics:  Unknown UPC",           !history.priceAt( "999", 500 ) );
+      affirm.is_true ( "Basics:  Price at time",         history.priceAt( "001", 100 ) == Cents{ 399 }  &&  history.priceAt( "001", 399 ) == Cents{ 349 }
+                                                     &&  history.priceAt( "001", 1'000 ) == Cents{ 429 } );
+      affirm.is_true ( "Basics:  Min includes price current at window start",  history.minOver( "001", 250, 450 ) == Cents{ 349 } );
+
+      try
+      {
+        history.record( "001", 399, 100 );
+        affirm.is_true( "Basics:  Out of order rejected", false );
+      }
+      catch( PriceHistory::OutOfOrder_Ex const & )
+      {
+        affirm.is_true( "Basics:  Out of order rejected", true );
+      }
+    }
+
+    {
+      // Changes too large for the delta columns start a new block and are still read back exactly
+      PriceHistory history;
+      history.record( "big", 0,                      1                  );
+      history.record( "big", 10'000'000'000LL,       5'000'000'000LL    );
+      history.record( "big", 10'000'000'001LL,       2                  );
+      affirm.is_true( "Wide deltas", history.priceAt( "big", 9'999'999'999LL ) == Cents{ 1 }  &&  history.priceAt( "big", 10'000'000'000LL ) == Cents{ 5'000'000'000LL }
+                                 &&  history.biggestChanges( 1 ).front().to == 5'000'000'000LL );
+    }
+
+    {
+      // Fed from grocery items and a catalog load
+      PriceCatalog catalog = { { "cereal", "Brand A", "001", 4.00 }, { "milk", "Brand B", "003", 2.50 } };
+      PriceHistory history;
+      affirm.is_equal( "Feed:  Catalog load",         2U, history.record( catalog, 10 ) );
+
+      GroceryItem milk( "milk", "Brand B", "003", 2.50 );
+      history.record( milk.price( 2.75 ), 20 );
+      affirm.is_equal( "Feed:  Unchanged catalog",    0U, history.record( PriceCatalog{ { "cereal", "Brand A", "001", 4.00 } }, 30 ) );
+      affirm.is_true ( "Feed:  Grocery item update",  history.priceAt( "003", 15 ) == Cents{ 250 }  &&  history.priceAt( "003", 20 ) == Cents{ 275 } );
+    }
+
+    {
+      // Random histories checked against a brute force scan of the raw (time, price) pairs
+      std::mt19937 generator( 323 );
+      PriceHistory history;
+      std::vector<std::vector<std::pair<std::int64_t, Cents>>> reference( 200 );
+
+      for( std::int64_t time = 0; time < 20'000; ++time )
+      {
+        auto   upc   = generator() % reference.size();
+        Cents  price = 100 + generator() % 400;
+        auto & raw   = reference[upc];
+        if( history.record( std::to_string( upc ), time, price ) )   raw.emplace_back( time, price );
+        time += generator() % 3;
+      }
+
+      auto priceAt = [&]( std::size_t upc, std::int64_t when ) -> std::optional<Cents>
+      {
+        std::optional<Cents> result;
+        for( auto [time, price] : reference[upc] )   if( time <= when )   result = price;
+        return result;
+      };
+
+      bool pricesAgree = true, minimumsAgree = true;
+      for( unsigned i = 0; i < 2'000; ++i )
+      {
+        auto         upc  = generator() % reference.size();
+        std::int64_t from = generator() % 22'000,  to = from + generator() % 3'000;
+
+        pricesAgree = pricesAgree  &&  history.priceAt( std::to_string( upc ), from ) == priceAt( upc, from );
+
+        std::optional<Cents> lowest = priceAt( upc, from );
+        for( auto [time, price] : reference[upc] )   if( time > from  &&  time <= to )   lowest = lowest ? std::min( *lowest, price ) : price;
+        minimumsAgree = minimumsAgree  &&  history.minOver( std::to_string( upc ), from, to ) == lowest;
+      }
+
+      std::vector<std::pair<Cents, std::int64_t>> changes;                  // (-amount, time), so sorting puts the largest, then earliest, first
+      for( auto && raw : reference )
+        for( std::size_t i = 1; i < raw.size(); ++i )
+          if( raw[i].first >= 5'000  &&  raw[i].first <= 15'000 )   changes.emplace_back( -std::abs( raw[i].second - raw[i - 1].second ), raw[i].first );
+      std::sort( changes.begin(), changes.end() );
+
+      auto biggest      = history.biggestChanges( 25, 5'000, 15'000 );
+      bool changesAgree = biggest.size() == 25;
+      for( std::size_t i = 0;  changesAgree  &&  i < biggest.size();  ++i )
+      {
+        changesAgree = -std::abs( biggest[i].to - biggest[i].from ) == changes[i].first  &&  biggest[i].when == changes[i].second
+                   &&  history.priceAt( biggest[i].upcCode, biggest[i].when ) == biggest[i].to;
+      }
+
+      affirm.is_true( "Random:  Price at time",   pricesAgree   );
+      affirm.is_true( "Random:  Min over window", minimumsAgree );
+      affirm.is_true( "Random:  Biggest changes", changesAgree  );
+    }
+  }
+
+
+
+
+  PriceHistoryRegressionTest::PriceHistoryRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nPriceHistory Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nPriceHistory Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class PriceHistory\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,398 @@
+#include <algorithm>                                                                // min(), nth_element(), partial_sort(), sort(), unique()
+#include <array>
+#include <cstddef>                                                                  // size_t
+#include <cstdint>                                                                  // uint8_t, uint16_t, uint32_t, uint64_t
+#include <limits>                                                                   // numeric_limits
+#include <stdexcept>                                                                // length_error
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>                                                                  // move()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "ProductSearchIndex.hpp"
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // For each byte value, a bit mask of the pattern positions holding that byte
+  using PatternMasks = std::array<std::uint64_t, 256>;
+
+  PatternMasks patternMasks( std::string_view pattern ) noexcept
+  {
+    PatternMasks masks{};
+    for( std::size_t i = 0; i < pattern.size(); ++i )   masks[static_cast<unsigned char>( pattern[i] )] |= std::uint64_t{ 1 } << i;
+    return masks;
+  }
+
+
+
+  // The fewest edits turning pattern into some substring of text (Myers' bit-parallel algorithm, Hyyrö's formulation).  Each bit of
+  // the vertical delta vectors describes one row of the dynamic programming column, so a whole column advances in a handful of word
+  // operations per text character.  The pattern must be 1 to 64 characters.
+  unsigned editDistance( std::size_t patternLength, PatternMasks const & masks, std::string_view text ) noexcept
+  {
+    std::uint64_t const lastRow  = std::uint64_t{ 1 } << ( patternLength - 1 );
+    std::uint64_t       positive = ~std::uint64_t{ 0 };
+    std::uint64_t       negative = 0;
+    auto                score    = static_cast<unsigned>( patternLength );
+    auto                best     = score;
+
+    for( auto c : text )
+    {
+      auto const equal      = masks[static_cast<unsigned char>( c )];
+      auto const vertical   = equal | negative;
+      auto const horizontal = ( ( ( equal & positive ) + positive ) ^ positive ) | equal;
+      auto       hPositive  = negative | ~( horizontal | positive );
+      auto       hNegative  = positive & horizontal;
+
+      if     ( hPositive & lastRow )   ++score;
+      else if( hNegative & lastRow )   --score;
+
+      // No carry into row 0:  a match may begin anywhere in the text
+      hPositive <<= 1;
+      hNegative <<= 1;
+      positive    = hNegative | ~( vertical | hPositive );
+      negative    = hPositive & vertical;
+
+      best = std::min( best, score );
+    }
+
+    return best;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Accessors
+*******************************************************************************/
+
+// search() const
+std::vector<ProductSearchIndex::Match> ProductSearchIndex::search( std::string_view query, std::size_t k ) const
+{
+  // The pattern is the normalized query without its padding (so "chip" matches inside "chips") and at most one machine word long.
+  // Trigrams come from the padded form, so word boundaries still count toward a candidate's hits.
+  auto const text = queryText( query );
+  if( text.empty()  ||  k == 0 )   return {};
+
+  auto const pattern = std::string_view( text ).substr( 1, text.size() - 2 );
+
+
+  // Gather the query's posting lists and walk them rarest first, counting each document's hits.  Rare trigrams are the telling ones
+  // and the cheapest to walk, so stop once the next list would exceed the walking budget.  That bounds a query's cost regardless of
+  // catalog size; a query whose every trigram is very common is answered from the oldest documents sharing its rarest one.
+  std::vector<std::vector<std::uint32_t> const *> postings;
+  for( auto trigram : trigrams( text ) )
+  {
+    if( auto entry = _postings.find( trigram );  entry != _postings.end() )   postings.push_back( &entry->second );
+  }
+  std::sort( postings.begin(), postings.end(), []( auto lhs, auto rhs ) { return lhs->size() < rhs->size(); } );
+
+  _hitCounts.resize( _texts.size(), 0 );
+
+  std::size_t walked = 0;
+  for( std::size_t i = 0; i < postings.size(); ++i )
+  {
+    if( i > 0  &&  walked + postings[i]->size() > MAX_POSTINGS_WALKED )   break;
+
+    auto const length = std::min( postings[i]->size(), MAX_POSTINGS_WALKED );
+    for( std::size_t j = 0; j < length; ++j )
+    {
+      auto document = ( *postings[i] )[j];
+      if( !_alive[document] )   continue;
+      if( _hitCounts[document]++ == 0 )   _touched.push_back( document );
+    }
+    walked += length;
+  }
+
+
+  // Keep the documents sharing the most trigrams, then score each with the exact edit distance.  Hit counts are small (at most one
+  // per posting list walked), so a histogram finds the cutoff in one pass instead of a comparison based selection.
+  auto const candidateCount = std::min( _touched.size(), std::max( MIN_CANDIDATES, k * 8 ) );
+
+  std::vector<std::size_t> histogram( postings.size() + 1, 0 );
+  for( auto document : _touched )   ++histogram[_hitCounts[document]];
+
+  auto        cutoff     = histogram.size() - 1;
+  std::size_t aboveCount = 0;                                                       // documents with more hits than cutoff
+  while( cutoff > 0  &&  aboveCount + histogram[cutoff] < candidateCount )   aboveCount += histogram[cutoff--];
+
+  // Keep every document above the cutoff and as many at the cutoff as fit.  The rest are done with, so clear their hits now.
+  std::size_t kept = 0, atCutoff = candidateCount - aboveCount;
+  for( auto document : _touched )
+  {
+    if     ( _hitCounts[document] >  cutoff                    )   _touched[kept++] = document;
+    else if( _hitCounts[document] == cutoff  &&  atCutoff > 0  ) { _touched[kept++] = document;  --atCutoff; }
+    else                                                           _hitCounts[document] = 0;
+  }
+  _touched.resize( kept );
+
+  struct Candidate
+  {
+    std::uint32_t document;
+    unsigned      distance;
+    std::uint16_t hits;
+  };
+
+  auto const masks = patternMasks( pattern );
+
+  std::vector<Candidate> candidates;
+  candidates.reserve( candidateCount );
+  for( std::size_t i = 0; i < candidateCount; ++i )
+  {
+    auto document = _touched[i];
+    candidates.push_back( { document, editDistance( pattern.size(), masks, _texts[document] ), _hitCounts[document] } );
+  }
+
+  for( auto document : _touched )   _hitCounts[document] = 0;
+  _touched.clear();
+
+
+  // Closest first, then most trigrams shared, then the shortest (most specific) text
+  auto const resultCount = std::min( k, candidates.size() );
+  std::partial_sort( candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>( resultCount ), candidates.end(),
+                     [this]( Candidate const & lhs, Candidate const & rhs )
+                     {
+                       if( lhs.distance != rhs.distance )   return lhs.distance < rhs.distance;
+                       if( lhs.hits     != rhs.hits     )   return lhs.hits     > rhs.hits;
+                       if( _texts[lhs.document].size() != _texts[rhs.document].size() )   return _texts[lhs.document].size() < _texts[rhs.document].size();
+                       return lhs.document < rhs.document;
+                     } );
+
+  std::vector<Match> matches;
+  matches.reserve( resultCount );
+  for( std::size_t i = 0; i < resultCount; ++i )   matches.push_back( { _ids[candidates[i].document], candidates[i].distance } );
+
+  return matches;
+}
+
+
+
+// rank()
+std::vector<std::size_t> ProductSearchIndex::rank( std::string_view query, std::span<GroceryItem const> groceryItems, std::size_t k )
+{
+  auto const text = queryText( query );
+  if( text.empty()  ||  k == 0 )   return {};
+
+  auto const pattern       = std::string_view( text ).substr( 1, text.size() - 2 );
+  auto const masks         = patternMasks( pattern );
+  auto const queryTrigrams = trigrams( text );
+
+  struct Candidate
+  {
+    std::size_t position;
+    unsigned    distance;
+    std::size_t hits;
+    std::size_t length;
+  };
+
+  // Too few items to be worth narrowing down first, so each one's trigrams are counted and its edit distance taken in turn
+  std::vector<Candidate> candidates;
+  for( std::size_t position = 0; position < groceryItems.size(); ++position )
+  {
+    auto const itemText     = normalize( groceryItems[position].productName() + ' ' + groceryItems[position].brandName() );
+    auto const itemTrigrams = trigrams( itemText );
+
+    std::size_t hits = 0;
+    for( auto q = queryTrigrams.begin(), i = itemTrigrams.begin();  q != queryTrigrams.end()  &&  i != itemTrigrams.end(); )
+    {
+      if     ( *q < *i )   ++q;
+      else if( *i < *q )   ++i;
+      else               { ++hits;  ++q;  ++i; }
+    }
+    if( hits == 0 )   continue;
+
+    candidates.push_back( { position, editDistance( pattern.size(), masks, itemText ), hits, itemText.size() } );
+  }
+
+  // Same order as search():  closest first, then most trigrams shared, then the shortest (most specific) text
+  auto const resultCount = std::min( k, candidates.size() );
+  std::partial_sort( candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>( resultCount ), candidates.end(),
+                     []( Candidate const & lhs, Candidate const & rhs )
+                     {
+                       if( lhs.distance != rhs.distance )   return lhs.distance < rhs.distance;
+                       if( lhs.hits     != rhs.hits     )   return lhs.hits     > rhs.hits;
+                       if( lhs.length   != rhs.length   )   return lhs.length   < rhs.length;
+                       return lhs.position < rhs.position;
+                     } );
+
+  std::vector<std::size_t> positions;
+  positions.reserve( resultCount );
+  for( std::size_t i = 0; i < resultCount; ++i )   positions.push_back( candidates[i].position );
+
+  return positions;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Modifiers
+*******************************************************************************/
+
+// insert()
+void ProductSearchIndex::insert( DocumentID id, GroceryItem const & groceryItem )
+{
+  remove( id );
+
+  if( _texts.size() >= std::numeric_limits<std::uint32_t>::max() )   throw std::length_error( "Product search index is full" );
+  auto const document = static_cast<std::uint32_t>( _texts.size() );
+
+  // Internal documents are only ever appended, so every posting list stays in ascending order
+  auto text = normalize( groceryItem.productName() + ' ' + groceryItem.brandName() );
+  for( auto trigram : trigrams( text ) )   _postings[trigram].push_back( document );
+
+  _texts      .push_back( std::move( text ) );
+  _ids        .push_back( id );
+  _alive      .push_back( 1 );
+  _internalIDs.emplace( id, document );
+}
+
+
+
+// remove()
+void ProductSearchIndex::remove( DocumentID id )
+{
+  auto entry = _internalIDs.find( id );
+  if( entry == _internalIDs.end() )   return;
+
+  auto const document = entry->second;
+  _internalIDs.erase( entry );
+  _alive[document] = 0;
+  std::string().swap( _texts[document] );
+
+  if( _texts.size() - size() > size() )   compact();
+}
+
+
+
+// clear()
+void ProductSearchIndex::clear() noexcept
+{
+  _texts      .clear();
+  _ids        .clear();
+  _alive      .clear();
+  _internalIDs.clear();
+  _postings   .clear();
+  _hitCounts  .clear();
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Private member functions
+*******************************************************************************/
+
+// queryText()
+std::string ProductSearchIndex::queryText( std::string_view query )
+{
+  auto text = normalize( query );
+  if( text.size() <= 2 )   return {};
+  if( text.size() > MAX_QUERY_LENGTH + 2 )   text = text.substr( 0, MAX_QUERY_LENGTH + 1 ) + ' ';
+  return text;
+}
+
+
+
+// normalize()
+std::string ProductSearchIndex::normalize( std::string_view text )
+{
+  std::string result( 1, ' ' );
+  result.reserve( text.size() + 2 );
+
+  for( auto c : text )
+  {
+    if     ( c >= 'A'  &&  c <= 'Z' )                          result += static_cast<char>( c - 'A' + 'a' );
+    else if( ( c >= 'a'  &&  c <= 'z' )  ||  ( c >= '0'  &&  c <= '9' ) )   result += c;
+    else if( c == '\'' )                                        continue;                 // "Kellogg's" reads as "kelloggs", not two words
+    else if( result.back() != ' ' )                            result += ' ';
+  }
+
+  if( result.back() != ' ' )   result += ' ';
+  return result;
+}
+
+
+
+// trigrams()
+std::vector<ProductSearchIndex::Trigram> ProductSearchIndex::trigrams( std::string_view normalizedText )
+{
+  std::vector<Trigram> result;
+  if( normalizedText.size() < 3 )   return result;
+
+  result.reserve( normalizedText.size() - 2 );
+  for( std::size_t i = 0; i + 2 < normalizedText.size(); ++i )
+  {
+    result.push_back(   Trigram{ static_cast<unsigned char>( normalizedText[i    ] ) } << 16
+                      | Trigram{ static_cast<unsigned char>( normalizedText[i + 1] ) } <<  8
+                      | Trigram{ static_cast<unsigned char>( normalizedText[i + 2] ) } );
+  }
+
+  std::sort( result.begin(), result.end() );
+  result.erase( std::unique( result.begin(), result.end() ), result.end() );
+  return result;
+}
+
+
+
+// compact()
+void ProductSearchIndex::compact()
+{
+  // Renumber the live documents in their existing order, which keeps every posting list ascending without re-sorting
+  std::vector<std::uint32_t> renumbered( _texts.size(), std::numeric_limits<std::uint32_t>::max() );
+  std::uint32_t              liveCount = 0;
+
+  for( std::size_t document = 0; document < _texts.size(); ++document )
+  {
+    if( !_alive[document] )   continue;
+
+    renumbered[document] = liveCount;
+    if( document != liveCount )
+    {
+      _texts[liveCount] = std::move( _texts[document] );
+      _ids  [liveCount] = _ids[document];
+      _internalIDs[_ids[liveCount]] = liveCount;
+    }
+    ++liveCount;
+  }
+
+  _texts.resize( liveCount );
+  _ids  .resize( liveCount );
+  _alive.assign( liveCount, 1 );
+  _hitCounts.clear();
+
+  for( auto entry = _postings.begin(); entry != _postings.end(); )
+  {
+    auto & documents = entry->second;
+    std::size_t kept = 0;
+    for( auto document : documents )
+    {
+      if( renumbered[document] != std::numeric_limits<std::uint32_t>::max() )   documents[kept++] = renumbered[document];
+    }
+    documents.resize( kept );
+
+    if( documents.empty() )   entry = _postings.erase( entry );
+    else                      ++entry;
+  }
+}
@@ -0,0 +1,82 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint16_t, uint32_t
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "GroceryItem.hpp"
+
+
+
+
+// A fuzzy search index over grocery items' product and brand names.
+//
+// Searching is two steps.  A trigram inverted index narrows the catalog to the documents sharing the most three-letter sequences
+// with the query (so "hotdogs" still finds "hot dogs"), then each of those candidates is scored by the edit distance between the
+// query and its closest substring of the document, computed bit-parallel (Myers' algorithm, 64 pattern characters per machine
+// word).  Text is compared case-insensitively with apostrophes dropped and other punctuation folded to spaces.
+//
+// Documents are identified by a caller chosen ID (e.g. a stable handle).  Insertions and removals update the index incrementally:
+// removal only marks the document dead, and the postings are compacted once dead documents outnumber live ones.
+//
+// Queries reuse internal scratch buffers, so a single index must not be searched from several threads at once.
+class ProductSearchIndex
+{
+  public:
+    // Types and Exceptions
+    using DocumentID = std::uint32_t;
+
+    struct Match
+    {
+      DocumentID id;
+      unsigned   distance;                                                                    // edits needed to turn the query into part of the document's text
+    };
+
+
+    // Queries
+    std::size_t size() const noexcept { return _internalIDs.size(); }                        // number of live documents
+
+
+    // Accessors
+    std::vector<Match> search( std::string_view query, std::size_t k = 10 ) const;            // best k matches, closest first
+
+    // Scores a handful of grocery items directly, with no index to build or keep up to date (e.g. the few items on one grocery list).
+    // Items sharing a trigram with the query are ordered as search() orders its candidates.  Returns positions in groceryItems.
+    static std::vector<std::size_t> rank( std::string_view query, std::span<GroceryItem const> groceryItems, std::size_t k = 10 );
+
+
+    // Modifiers
+    void insert( DocumentID id, GroceryItem const & groceryItem );                            // replaces any document already using id
+    void remove( DocumentID id );                                                             // no change occurs if id isn't indexed
+    void clear ()                                     noexcept;
+
+
+  private:
+    using Trigram = std::uint32_t;                                                            // three bytes packed into the low 24 bits
+
+    static constexpr std::size_t MAX_QUERY_LENGTH    = 64;                                    // one machine word of pattern bits
+    static constexpr std::size_t MIN_CANDIDATES      = 256;                                   // documents scored per query, at least
+    static constexpr std::size_t MAX_POSTINGS_WALKED = 1 << 15;                               // posting entries counted per query, keeps a million document search under 1 ms
+
+    // Instance Attributes
+    std::vector<std::string>                                _texts;                           // per internal document (append order), normalized text
+    std::vector<DocumentID>                                 _ids;
+    std::vector<std::uint8_t>                               _alive;
+    std::unordered_map<DocumentID, std::uint32_t>           _internalIDs;                     // live documents only
+    std::unordered_map<Trigram, std::vector<std::uint32_t>> _postings;                        // trigram -> internal documents containing it, ascending
+
+    mutable std::vector<std::uint16_t>                      _hitCounts;                       // query scratch, indexed by internal document, all zero between queries
+    mutable std::vector<std::uint32_t>                      _touched;
+
+
+    // Helper member functions
+    static std::string          queryText( std::string_view query );                          // normalized query, cut to MAX_QUERY_LENGTH, empty if too short to search for
+    static std::string          normalize( std::string_view text );                           // lower case, apostrophes dropped, other punctuation folded to single spaces, padded with a space each end
+    static std::vector<Trigram> trigrams ( std::string_view normalizedText );                 // distinct, ascending
+
+    void compact();
+};
@@ -0,0 +1,181 @@
+#include <algorithm>                                                      // min()
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <string>                                                         // to_string()
+#include <string_view>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "ProductSearchIndex.hpp"
+
+
+
+namespace    // anonymous
+{
+  class ProductSearchIndexRegressionTest
+  {
+    public:
+      ProductSearchIndexRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_product_search_index_tests;
+
+
+
+
+  // Textbook O(mn) distance from pattern to its closest substring of text, to check the bit-parallel version against
+  unsigned referenceDistance( std::string_view pattern, std::string_view text )
+  {
+    std::vector<unsigned> column( pattern.size() + 1 );
+    for( std::size_t i = 0; i <= pattern.size(); ++i )   column[i] = static_cast<unsigned>( i );
+
+    auto best = column.back();
+    for( auto c : text )
+    {
+      unsigned diagonal = column[0];                                            // row 0 stays 0, a match may start anywhere
+      for( std::size_t i = 1; i <= pattern.size(); ++i )
+      {
+        auto above = column[i];
+        column[i]  = std::min( { above + 1, column[i - 1] + 1, diagonal + ( pattern[i - 1] == c ? 0U : 1U ) } );
+        diagonal   = above;
+      }
+      best = std::min( best, column.back() );
+    }
+    return best;
+  }
+
+
+
+
+  void ProductSearchIndexRegressionTest::test()
+  {
+    ProductSearchIndex index;
+    index.insert( 10, { "Hot Dogs, Beef",        "Oscar Mayer"   } );
+    index.insert( 20, { "Potato Chips",          "Ruffles"       } );
+    index.insert( 30, { "Peppermint Patties",    "York"          } );
+    index.insert( 40, { "Corn Flakes",           "Kellogg's"     } );
+    index.insert( 50, { "Frosted Flakes",        "Kellogg's"     } );
+
+    {
+      affirm.is_equal( "Search:  Size",                       5U,  index.size() );
+
+      auto matches = index.search( "potato chips", 1 );
+      affirm.is_true ( "Search:  Exact match first",          matches.size() == 1  &&  matches[0].id == 20  &&  matches[0].distance == 0 );
+
+      matches = index.search( "hotdogs", 1 );
+      affirm.is_true ( "Search:  Missing space",              matches.size() == 1  &&  matches[0].id == 10  &&  matches[0].distance == 1 );
+
+      matches = index.search( "PEPERMINT", 1 );
+      affirm.is_true ( "Search:  Typo, any case",             matches.size() == 1  &&  matches[0].id == 30  &&  matches[0].distance == 1 );
+
+      matches = index.search( "kelloggs", 10 );
+      affirm.is_true ( "Search:  Brand name matches all",     matches.size() >= 2  &&  matches[0].distance == 0  &&  matches[1].distance == 0 );
+
+      matches = index.search( "flakes corn", 2 );
+      affirm.is_true ( "Search:  Closest ranks first",        matches.size() == 2  &&  matches[0].id == 40 );
+
+      affirm.is_true ( "Search:  Empty query",                index.search( " ,. " ).empty() );
+      affirm.is_true ( "Search:  No shared trigrams",         index.search( "xyzzy" ).empty() );
+    }
+
+    {
+      index.remove( 20 );
+      affirm.is_equal( "Remove:  Size",                       4U,  index.size() );
+
+      auto matches = index.search( "potato chips" );
+      bool found   = false;
+      for( auto && match : matches )   found = found || match.id == 20;
+      affirm.is_true ( "Remove:  Removed document not found", !found );
+
+      index.insert( 40, { "Potato Chips", "Lay's" } );
+      matches = index.search( "potato chips", 1 );
+      affirm.is_true ( "Insert:  Reusing an ID replaces",     index.size() == 4  &&  matches.size() == 1  &&  matches[0].id == 40 );
+    }
+
+    {
+      // Remove most of a larger catalog, forcing compaction, and check the survivors are still found under their own IDs
+      ProductSearchIndex catalog;
+      for( unsigned i = 0; i < 2'000; ++i )   catalog.insert( i, { "product " + std::to_string( i * 7919 ), "brand " + std::to_string( i % 13 ) } );
+      for( unsigned i = 0; i < 2'000; ++i )   if( i % 4 != 0 )   catalog.remove( i );
+
+      bool allFound = catalog.size() == 500;
+      for( unsigned i = 0; allFound && i < 2'000; i += 4 )
+      {
+        auto matches = catalog.search( "product " + std::to_string( i * 7919 ) + " brand " + std::to_string( i % 13 ), 1 );
+        allFound     = matches.size() == 1  &&  matches[0].id == i  &&  matches[0].distance == 0;
+      }
+      affirm.is_true( "Compaction:  Survivors found by ID", allFound );
+
+      // Every reported distance must agree with the textbook dynamic program
+      bool allAgree = true;
+      for( std::string_view query : { "prodct 1234", "brand 12", "produkt 99", "7919 brnd" } )
+      {
+        for( auto && match : catalog.search( query, 20 ) )
+        {
+          std::string text = "product " + std::to_string( match.id * 7919 ) + " brand " + std::to_string( match.id % 13 );
+          allAgree = allAgree  &&  match.distance == referenceDistance( query, text );
+        }
+      }
+      affirm.is_true( "Scoring:  Matches reference edit distance", allAgree );
+    }
+
+    {
+      std::vector<GroceryItem> groceryItems = { { "Corn Flakes",    "Kellogg's"   },
+                                                { "Hot Dogs, Beef", "Oscar Mayer" },
+                                                { "Frosted Flakes", "Kellogg's"   } };
+
+      affirm.is_true( "Rank:  Closest first, by position",    ProductSearchIndex::rank( "hotdogs",   groceryItems, 1 ) == std::vector<std::size_t>{ 1 }
+                                                          &&  ProductSearchIndex::rank( "flakes",    groceryItems    ) == std::vector<std::size_t>{ 0, 2 } );
+      affirm.is_true( "Rank:  No shared trigrams",            ProductSearchIndex::rank( "xyzzy",     groceryItems    ).empty() );
+      affirm.is_true( "Rank:  Empty query",                   ProductSearchIndex::rank( " ,. ",      groceryItems    ).empty() );
+    }
+
+    {
+      GroceryList groceryList = { { "Corn Flakes",    "Kellogg's" },
+                                  { "Hot Dogs, Beef", "Oscar Mayer" },
+                                  { "Potato Chips",   "Ruffles" } };
+
+      affirm.is_true( "Grocery list:  Search returns offsets", groceryList.search( "hot dog", 1 ) == std::vector<std::size_t>{ 1 } );
+
+      groceryList.remove( 0 );
+      groceryList.insert( { "Frosted Flakes", "Kellogg's" }, GroceryList::Position::BOTTOM );
+      affirm.is_true( "Grocery list:  Offsets follow edits",   groceryList.search( "potato chip", 1 ) == std::vector<std::size_t>{ 1 }
+                                                           &&  groceryList.search( "frosted",     1 ) == std::vector<std::size_t>{ 2 } );
+
+      auto copy = groceryList;
+      copy.remove( 1 );
+      affirm.is_true( "Grocery list:  Copies search independently", copy.search( "frosted", 1 ) == std::vector<std::size_t>{ 1 }
+                                                                &&  groceryList.search( "frosted", 1 ) == std::vector<std::size_t>{ 2 } );
+    }
+  }
+
+
+
+
+  ProductSearchIndexRegressionTest::ProductSearchIndexRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nProductSearchIndex Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nProductSearchIndex Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class ProductSearchIndex\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,124 @@
+#pragma once                                                                                  // include guard
+
+#include <array>
+#include <atomic>
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint32_t
+#include <optional>
+#include <utility>                                                                            // move()
+
+
+
+
+// A bounded, single producer single consumer queue for handing work between two threads.
+//
+// The slots are a fixed ring indexed by two ever increasing counters, each written by only one side, so an uncontended push or pop
+// is a few atomic loads and one store.  A side that finds the ring full (or empty) registers as a waiter and blocks on a shared
+// change counter with C++20 atomic wait/notify rather than spinning.  Only when a waiter is registered does a push, pop, or close
+// bump that counter and notify, so the wake-up path (and its system call) is paid only by operations that have someone to wake.
+// close() releases both sides:  pushes then fail, and pops drain what's left before reporting the end.
+template<typename T, std::size_t Capacity>
+class SpscRing
+{
+  public:
+    // Modifiers
+    bool             push ( T value );                                                        // producer only, blocks while full, returns false (dropping value) once closed
+    std::optional<T> pop  ();                                                                 // consumer only, blocks while empty, returns nothing once closed and drained
+    void             close()       noexcept;                                                  // either side, or a third party, may close
+
+
+  private:
+    static_assert( Capacity > 0, "An SpscRing needs at least one slot" );
+
+    // Instance Attributes.  The counters live on separate cache lines so the two threads don't contend over one line.
+    alignas( 64 ) std::atomic<std::size_t>   _head    = 0;                                    // next slot to pop,  written by the consumer only
+    alignas( 64 ) std::atomic<std::size_t>   _tail    = 0;                                    // next slot to push, written by the producer only
+    alignas( 64 ) std::atomic<std::uint32_t> _changes = 0;                                    // bumped after a push, pop, or close while anyone waits
+                  std::atomic<std::uint32_t> _waiters = 0;                                    // sides blocked, or about to block, on _changes
+                  std::atomic<bool>          _closed  = false;
+                  std::array<T, Capacity>    _slots   = {};
+
+
+    // Helper member functions
+    template<typename Ready>
+    void awaitChange   ( Ready ready ) noexcept;                                              // blocks until another side announces a change, unless ready() already
+    void announceChange()              noexcept;
+};
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// push()
+template<typename T, std::size_t Capacity>
+bool SpscRing<T, Capacity>::push( T value )
+{
+  auto const tail = _tail.load();
+  auto const done = [&] { return _closed.load()  ||  tail - _head.load() < Capacity; };
+
+  while( !done() )   awaitChange( done );
+  if( _closed.load() )   return false;
+
+  _slots[tail % Capacity] = std::move( value );
+  _tail.store( tail + 1 );
+  announceChange();
+  return true;
+}
+
+
+
+// pop()
+template<typename T, std::size_t Capacity>
+std::optional<T> SpscRing<T, Capacity>::pop()
+{
+  auto const head = _head.load();
+  auto const done = [&] { return head != _tail.load()  ||  _closed.load(); };
+
+  while( !done() )   awaitChange( done );
+  if( head == _tail.load() )   return std::nullopt;                                      // closed and drained
+
+  std::optional<T> value = std::move( _slots[head % Capacity] );
+  _head.store( head + 1 );
+  announceChange();
+  return value;
+}
+
+
+
+// close()
+template<typename T, std::size_t Capacity>
+void SpscRing<T, Capacity>::close() noexcept
+{
+  _closed.store( true );
+  announceChange();
+}
+
+
+
+// awaitChange()
+template<typename T, std::size_t Capacity>
+template<typename Ready>
+void SpscRing<T, Capacity>::awaitChange( Ready ready ) noexcept
+{
+  // Register first, then read the change counter, then test once more.  A change that lands before the registration is seen by the
+  // test, and one after it sees the registration and bumps the counter, so the wait returns at once or is notified.  Every access
+  // is sequentially consistent, which is what keeps a store on one side and a load on the other from passing each other.
+  _waiters.fetch_add( 1 );
+  auto const seen = _changes.load();
+  if( !ready() )   _changes.wait( seen );
+  _waiters.fetch_sub( 1 );
+}
+
+
+
+// announceChange()
+template<typename T, std::size_t Capacity>
+void SpscRing<T, Capacity>::announceChange() noexcept
+{
+  if( _waiters.load() == 0 )   return;                                              // nobody to wake, so skip the atomic add and the notify
+  _changes.fetch_add( 1 );
+  _changes.notify_all();
+}
@@ -0,0 +1,89 @@
+#include <cstddef>                                                        // size_t
+#include <exception>
+#include <iomanip>                                                        // setprecision()
+#include <iostream>                                                       // boolalpha(), showpoint(), fixed()
+#include <thread>
+
+#include "CheckResults.hpp"
+#include "SpscRing.hpp"
+
+
+
+namespace    // anonymous
+{
+  class SpscRingRegressionTest
+  {
+    public:
+      SpscRingRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_spsc_ring_tests;
+
+
+
+
+  void SpscRingRegressionTest::test()
+  {
+    {
+      SpscRing<int, 2> ring;
+      affirm.is_true( "Push within capacity", ring.push( 1 )  &&  ring.push( 2 ) );
+      affirm.is_true( "Pop in order",         ring.pop() == 1 );
+
+      ring.close();
+      affirm.is_true( "Push after close fails",      !ring.push( 3 ) );
+      affirm.is_true( "Pop drains after close",      ring.pop() == 2 );
+      affirm.is_true( "Pop reports end after close", !ring.pop() );
+    }
+
+    {
+      // A producer far outrunning a tiny ring must block, not drop or reorder
+      constexpr unsigned   COUNT = 100'000;
+      SpscRing<unsigned, 4> ring;
+
+      std::thread producer( [&] { for( unsigned i = 0; i < COUNT; ++i )   ring.push( i );  ring.close(); } );
+
+      bool     inOrder = true;
+      unsigned count   = 0;
+      for( auto value = ring.pop();  value;  value = ring.pop() )   inOrder = inOrder  &&  *value == count++;
+      producer.join();
+
+      affirm.is_true( "Threaded:  every value, in order", inOrder  &&  count == COUNT );
+    }
+
+    {
+      // Closing releases a consumer blocked on an empty ring
+      SpscRing<int, 1> ring;
+      bool             released = false;
+      std::thread      consumer( [&] { released = !ring.pop(); } );
+      ring.close();
+      consumer.join();
+      affirm.is_true( "Close releases a blocked consumer", released );
+    }
+  }
+
+
+
+
+  SpscRingRegressionTest::SpscRingRegressionTest()
+  {
+    // affirm.policy = Regression::CheckResults::ReportingPolicy::ALL;
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nSpscRing Regression Tests:\n";
+      test();
+
+      std::clog << "\n\nSpscRing Regression Test " << affirm << "\n\n";
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class SpscRing\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
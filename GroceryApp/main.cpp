@@ -1,10 +1,16 @@
 #include <exception>
 #include <iostream>
 #include <sstream>                                                                    // istringstream
+#include <string>                                                                     // stoull()
+#include <string_view>
 #include <typeinfo>
 
+#include "Benchmarks.hpp"
+#include "Checkout.hpp"
 #include "GroceryItem.hpp"
 #include "GroceryList.hpp"
+#include "Instrumentation.hpp"
+#include "PriceCatalog.hpp"
 
 
 
@@ -78,19 +84,65 @@ namespace
               << "\nActual results:  " << thingsToBuy     << "\n\n"
               << "\nTest results:    " << ( thingsToBuy == expectedResults ? "PASS" : "FAIL" ) << '\n';
   }
+
+
+
+
+  void purchaseScenario()
+  {
+    // The store's price catalog, keyed by UPC code
+    PriceCatalog catalog = { { "Nature's Own Butter Buns Hotdog - 8 Ct",                    "Nature's Own",    "00072250018548", 3.49 },
+                             { "Nestle \"Media Crema\" Table Cream",                        "Nestle",          "00028000517205", 2.19 },
+                             { "York Peppermint Patties Dark Chocolate Covered Snack Size", "York",            "00034000020706", 4.99 },
+                             { "Kellogg's Cereal Krave Chocolate",                          "Kellogg's",       "00038000570742", 5.29 },
+                             { "Kellogg's Frosted Flakes",                                  "Kellogg's",       "00038000001208", 4.79 },
+                             { "Pepperidge Farm Classic Cookie Favorites",                  "Pepperidge Farm", "00014100072331", 6.49 } };
+
+    // This week's promotions:  50 cents off York patties, and 15% off anything from Kellogg's
+    catalog.addItemPromotion ( "00034000020706", { PriceCatalog::Promotion::Kind::AMOUNT_OFF,  50    } );
+    catalog.addBrandPromotion( "Kellogg's",      { PriceCatalog::Promotion::Kind::PERCENT_OFF, 1'500 } );
+
+    // What made it into the cart.  The list's prices are what I expected to pay, the catalog decides what I actually pay.
+    GroceryList cart = { { "Nature's Own Butter Buns Hotdog - 8 Ct",                    "Nature's Own", "00072250018548" },
+                         { "York Peppermint Patties Dark Chocolate Covered Snack Size", "York",         "00034000020706" },
+                         { "Kellogg's Cereal Krave Chocolate",                          "Kellogg's",    "00038000570742" },
+                         { "Kellogg's Frosted Flakes",                                  "Kellogg's",    "00038000001208" },
+                         { "bananas",                                                   "",             "",              1.25 } };
+
+    CheckoutEngine register1( catalog );
+    std::cout << "\n\nReceipt" << register1.checkout( cart ) << "\n\n";
+  }
 }
 
 
 
 
-int main()
+int main( int argc, char * argv[] )
 {
   try
   {
-    basicScenario();
+    // Benchmarks take a while, so they run only when asked for:  ./project --benchmark [largest size, 10000000 by default].  Build
+    // with -DGROCERY_COUNT_ALLOCATIONS, and without GROCERY_INSTRUMENTATION's probes, to get times and allocations per operation together.
+    if( argc > 1  &&  std::string_view( argv[1] ) == "--benchmark" )
+    {
+      fixedGroceryListBenchmark( std::cout );
+      if( argc > 2 )   groceryBenchmark( std::cout, std::stoull( argv[2] ) );
+      else             groceryBenchmark( std::cout );
+      return 0;
+    }
+
+    // In an instrumented build, ./project --instrumentation (or --instrumentation=json) reports where the scenarios spent their time
+    #if defined( GROCERY_INSTRUMENTATION )
+      Instrumentation::reset();                                                       // leave out the regression tests
+    #endif
 
+    basicScenario();
+    purchaseScenario();
 
-  // Implement realistic grocery list purchase ->>>
+    #if defined( GROCERY_INSTRUMENTATION )
+      if( argc > 1  &&  std::string_view( argv[1] ) == "--instrumentation"      )   Instrumentation::snapshot().writeText( std::cout );
+      if( argc > 1  &&  std::string_view( argv[1] ) == "--instrumentation=json" )   Instrumentation::snapshot().writeJson( std::cout );
+    #endif
   }
 
   catch( const std::exception & ex )
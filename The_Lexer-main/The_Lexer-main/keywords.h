@@ -0,0 +1,130 @@
+#ifndef KEYWORDS_H
+#define KEYWORDS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// The language's keywords.  More can be added here, or at build time without touching the source:
+//		g++ -DLEXER_EXTRA_KEYWORDS='"return", "void"' ...
+// Keywords may be up to 16 characters long.
+#ifndef LEXER_EXTRA_KEYWORDS
+#define LEXER_EXTRA_KEYWORDS
+#endif
+
+constexpr std::string_view keywordList[] = { "cin", "cout", "while", "if", "else", "for", "int", "float", "endl", "double", LEXER_EXTRA_KEYWORDS };
+
+
+
+
+// A perfect hash over the keywords, found at compile time.
+//
+// A word of up to 16 characters is packed, zero padded, into two 64 bit integers.  Those are multiplied by a pair of constants and
+// the top bits of the result pick a slot in a small table, one slot per keyword at most.  The constants are searched for by the
+// compiler until no two keywords share a slot, so deciding whether an identifier is a keyword takes one hash and one compare of two
+// integers, never a string compare, whatever the word.
+namespace keywords
+{
+	constexpr std::size_t maxLength = 16;
+
+	struct Key
+	{
+		std::uint64_t low  = 0;
+		std::uint64_t high = 0;
+
+		friend constexpr bool operator==(const Key&, const Key&) = default;
+	};
+
+	// Only called for words of at most maxLength characters
+	constexpr Key pack(std::string_view word)
+	{
+		Key key;
+		for (std::size_t i = 0; i < word.size(); ++i)
+		{
+			std::uint64_t byte = static_cast<unsigned char>(word[i]);
+			if (i < 8) key.low  |= byte << (8 * i);
+			else       key.high |= byte << (8 * (i - 8));
+		}
+		return key;
+	}
+
+	struct Hash
+	{
+		std::uint64_t lowMultiplier  = 0;
+		std::uint64_t highMultiplier = 0;
+		unsigned      bits           = 0;	// the table has 2^bits slots
+
+		constexpr std::size_t operator()(Key key) const
+		{
+			return (key.low * lowMultiplier + key.high * highMultiplier) >> (64 - bits);
+		}
+	};
+
+	constexpr std::size_t count = std::size(keywordList);
+
+	constexpr bool collisionFree(const Hash& hash)
+	{
+		std::array<bool, 1024> taken = {};
+		for (std::string_view keyword : keywordList)
+		{
+			std::size_t slot = hash(pack(keyword));
+			if (taken[slot]) return false;
+			taken[slot] = true;
+		}
+		return true;
+	}
+
+	// Tries pseudo-random odd multipliers, from a table twice the size of the keyword set up, until one spreads the keywords out
+	constexpr Hash findHash()
+	{
+		for (std::string_view keyword : keywordList)
+		{
+			if (keyword.empty() || keyword.size() > maxLength) throw "keywords must be 1 to 16 characters long";
+		}
+
+		unsigned bits = 1;
+		while ((std::size_t{ 1 } << bits) < 2 * count) ++bits;
+
+		std::uint64_t state = 0x9E3779B97F4A7C15u;
+		for (; bits <= 10; ++bits)
+		{
+			for (int attempt = 0; attempt < 10'000; ++attempt)
+			{
+				// splitmix64
+				auto random = [&state]
+				{
+					std::uint64_t z = (state += 0x9E3779B97F4A7C15u);
+					z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+					z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+					return z ^ (z >> 31);
+				};
+
+				Hash hash = { random() | 1, random() | 1, bits };
+				if (collisionFree(hash)) return hash;
+			}
+		}
+		throw "no perfect hash found for the keywords";
+	}
+
+	inline constexpr Hash hash = findHash();
+
+	constexpr std::array<Key, std::size_t{ 1 } << hash.bits> makeTable()
+	{
+		std::array<Key, std::size_t{ 1 } << hash.bits> table = {};	// empty slots hold the all zero key, which no word packs to
+		for (std::string_view keyword : keywordList) table[hash(pack(keyword))] = pack(keyword);
+		return table;
+	}
+
+	inline constexpr auto table = makeTable();
+}
+
+constexpr bool isKeyword(std::string_view word)
+{
+	if (word.empty() || word.size() > keywords::maxLength) return false;
+
+	keywords::Key key = keywords::pack(word);
+	return keywords::table[keywords::hash(key)] == key;
+}
+
+#endif
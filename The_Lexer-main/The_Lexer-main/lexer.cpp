@@ -1,141 +1,135 @@
 #include <iostream>
 #include <string>
-#include <vector>
-#include <cctype>
-#include <regex>
-#include <iomanip>
+#include <string_view>
 #include <fstream>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+#include "lexer.h"
+#include "parallel_lexer.h"
 using namespace std;
 
-string readtext(const string& filename) 
+// Writes the token table.  Tokens arrive one at a time from the lexer and nothing is flushed until the stream's buffer fills.
+template <typename Tokens>
+void writeTable(Tokens& tokens, ostream& out)
 {
-    ifstream file(filename);
-    string textFile;
-
-    if (file.is_open()) 
-	{
-        // Read the entire file into the string
-        file.seekg(0, ios::end);
-        textFile.reserve(file.tellg());
-        file.seekg(0, ios::beg);
-
-        textFile.assign((istreambuf_iterator<char>(file)),istreambuf_iterator<char>());
+	out << "Token      |Lexeme \n";
+	out << "-----------|------\n";
 
-        file.close();
-    } 
-	
-	else 
+	for (const Token& token : tokens)
 	{
-        cerr << "Unable to open file: " << filename << endl;
-    }
-
-    return textFile;
+		out << tokenName(token.kind) << '|' << token.lexeme << '\n';
+	}
 }
 
 
-int main()
+// A corpus of about the given size, made of statements like the one in input_scode.txt with made up names (@ and #) and numbers ($)
+string generateCorpus(size_t bytes)
 {
-	ofstream outputFile("output.txt");
-
-  streambuf *original = std::cout.rdbuf();
-  cout.rdbuf(outputFile.rdbuf());
-
-
-	cout<< "Token      |Lexeme " << endl;
-	cout<< "-----------|------" << endl;
-
-	// not reading whole word i++ only i or i and + probably something worng with the pattern
-	string filename = "input_scode.txt";
-    string fileContents = readtext(filename);
-	string keywords[] = { "cin", "cout", "while", "if", "else", "for", "int", "float", "endl", "double" };
-	string regexId = "\\b(?!(cin|cout|while|for|if|else|int|float|endl|double)\\b)[a-zA-Z_]\\w*\\b"; 
-	string symbol = "[{}();,]";
-	string ope = "\\++ |\\-- |\\<< |\\>> |[\\+\\-*/=<>!%] |== |>= |<= |!= "; // adding space before == like | == |,
-	// it adds a space before == in output
-	// the pattern in ope should match the one in input in i++ ) where there is a space after i++
-	// so we add \\++ | here we add space after ++
-	// regex reads from left to right so if the small pattern match the larg one after | is ignored
-	string regexDig = "\\d+";
-	regex regexDigit(regexDig);
-	regex regexIdentifier(regexId);
-	regex regexOper(ope);
-	regex regexSy(symbol);
-	smatch match;
-	string::const_iterator  searchStart(fileContents.cbegin());
-
-
-
-	while (regex_search(searchStart, fileContents.cend(), match, regexDigit)) // != eol()
+	const vector<string> templates = {
+		"for ( int @ = 0; @ < $; @++ ) { cout << @ << endl; }\n",
+		"while ( @ != $ ) { # = # * $ + @ % $; @--; }\n",
+		"if ( @ >= # ) { @ = @ - #; } else { # = # / 2; }\n",
+		"    float @ = $; double # = @ * $; cin >> @ >> #;\n",
+	};
+	const string letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+
+	mt19937 generator(323);
+	auto name = [&]
 	{
-		//string matchDig = match[0];
-		//double number = stod(matchDig);
-		cout << "constant   |" << match[0]; // matchDig
-		// match[0] points to the entire matched substring
-		searchStart = match.suffix().first; // i++ and its like \n or newline
-		cout << endl;
+		string result(1 + generator() % 12, ' ');
+		for (char& c : result) c = letters[generator() % letters.size()];
+		return result + to_string(generator() % 100);
+	};
+
+	string corpus;
+	corpus.reserve(bytes + 128);
+	while (corpus.size() < bytes)
+	{
+		string a = name(), b = name(), n = to_string(generator() % 100000);
+		for (char c : templates[generator() % templates.size()])
+		{
+			if      (c == '@') corpus += a;
+			else if (c == '#') corpus += b;
+			else if (c == '$') corpus += n;
+			else               corpus += c;
+		}
 	}
+	return corpus;
+}
 
 
-	searchStart = fileContents.cbegin(); // reset starting point to th beginning of the fileContents string
-
+// Lexes a generated corpus on one thread, then in parallel on 1, 2, 4, ... threads up to the number of cores, and reports the rates.
+// The token count and a checksum over kinds, lengths, and positions show that every run saw the same tokens at the same places.
+// The checksum is a plain sum, kept cheap because the consumer runs on a single thread however many lex.
+void benchmark(size_t megabytes)
+{
+	cout << "Generating a " << megabytes << " MB corpus..." << endl;
+	string corpus = generateCorpus(megabytes * 1024 * 1024);
 
-	while (regex_search(searchStart, fileContents.cend(), match, regexIdentifier))
+	struct Tally
 	{
+		size_t tokens = 0;
+		size_t checksum = 0;
 
-
-
-		cout << "Identifier |" << match[0];
-		searchStart = match.suffix().first;
-		cout << endl;
-
-	}
-
-	searchStart = fileContents.cbegin();
-
-	while (regex_search(searchStart, fileContents.cend(), match, regexOper))
-	{
-		if (match[0] != ' ')
+		void add(const Token& token)
 		{
-			//cout << "space  |"<< match[0]; compiler reads white space 
-			//searchStart = match.suffix().first;
-			cout << "Operator   |" << match[0];
-			//searchStart = match.suffix().first;
-			cout << endl;
-
+			++tokens;
+			checksum += static_cast<size_t>(token.kind) + token.lexeme.size() * 3 + token.position.line * 7 + token.position.column * 11;
 		}
+	};
 
-		searchStart = match.suffix().first; // like i++ keeps
-		
+	auto report = [&](const string& mode, double seconds, const Tally& tally, double baseline)
+	{
+		cout << left << setw(22) << mode << right << fixed << setprecision(1)
+		     << setw(10) << corpus.size() / seconds / 1e6 << " MB/s"
+		     << setw(8) << baseline / seconds << "x"
+		     << setw(14) << tally.tokens << " tokens   checksum " << hex << tally.checksum << dec << '\n';
+	};
+
+	Tally serial;
+	auto start = chrono::steady_clock::now();
+	for (const Token& token : Lexer(corpus)) serial.add(token);
+	double serialSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	report("serial", serialSeconds, serial, serialSeconds);
+
+	unsigned cores = max(thread::hardware_concurrency(), 1u);
+	for (unsigned threads = 1; ; threads = min(threads * 2, cores))
+	{
+		Tally tally;
+		start = chrono::steady_clock::now();
+		parallel::lex(corpus, [&](span<const Token> tokens) { for (const Token& token : tokens) tally.add(token); }, threads);
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		report("parallel, " + to_string(threads) + (threads == 1 ? " thread" : " threads"), seconds, tally, serialSeconds);
 
-		//else
-		//{
-			//cout << "Operator   |" << match[0];
-			//searchStart = match.suffix().first;
-		//}
-		//cout << endl;
+		if (threads == cores) break;
 	}
+}
 
 
-	for (string keyword : keywords)
+int main(int argc, char* argv[])
+{
+	// lexer --benchmark [megabytes, 1024 by default]
+	if (argc > 1 && string_view(argv[1]) == "--benchmark")
 	{
-		if (fileContents.find(keyword) != string::npos)
-		{
-			cout << "keyword    |" << keyword << endl;
-		}
+		benchmark(argc > 2 ? stoul(argv[2]) : 1024);
+		return 0;
 	}
 
-	searchStart = fileContents.cbegin();
-
-	while (regex_search(searchStart, fileContents.cend(), match, regexSy))
+	string filename = "input_scode.txt";
+	ifstream inputFile(filename, ios::binary);
+	if (!inputFile.is_open())
 	{
-
-		cout << "Symbol     |" << match[0];
-
-		searchStart = match.suffix().first;
-		cout << endl;
+		cerr << "Unable to open file: " << filename << endl;
+		return 1;
 	}
 
-	std::cout.rdbuf(original);
-	outputFile.close();
+	// The source is lexed a chunk at a time as the table is written, so the whole file is never in memory at once
+	ofstream outputFile("output.txt");
+	TokenStream tokens(inputFile);
+	writeTable(tokens, outputFile);
 	return 0;
 }
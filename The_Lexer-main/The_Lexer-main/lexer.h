@@ -0,0 +1,407 @@
+#ifndef LEXER_H
+#define LEXER_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "keywords.h"
+
+// The token classes the lexer knows about, in the order the output table names them
+enum class TokenKind : std::uint8_t
+{
+	Keyword,
+	Identifier,
+	Constant,
+	Operator,
+	Symbol,
+	Unknown		// any character the language doesn't use, one at a time
+};
+
+struct SourcePosition
+{
+	std::size_t line   = 1;
+	std::size_t column = 1;
+};
+
+struct Token
+{
+	TokenKind        kind = TokenKind::Unknown;
+	std::string_view lexeme;	// points into the source text, or into a TokenStream's buffer until its next token is read
+	SourcePosition   position;	// where the lexeme starts
+};
+
+// The left column of the output table
+constexpr std::string_view tokenName(TokenKind kind)
+{
+	constexpr std::array<std::string_view, 6> names = { "keyword    ", "Identifier ", "constant   ", "Operator   ", "Symbol     ", "Unknown    " };
+	return names[static_cast<std::size_t>(kind)];
+}
+
+
+
+
+
+// The finite state machine behind the lexer, built as tables at compile time.
+//
+// Every byte is first put in a character class, then the machine moves from state to state on classes until it has nowhere to go.
+// The state it stopped in says what kind of token it read, so each token is found with one table lookup per character and tokens
+// come out in the order they appear in the source.
+//
+//   START --letter/_--> IDENTIFIER --letter/_/digit--> IDENTIFIER
+//   START --digit-->    CONSTANT   --digit-->          CONSTANT
+//   START --+-->  PLUS    --+-->    OPERATOR_END          (+  ++)
+//   START ---->   MINUS   ---->     OPERATOR_END          (-  --)
+//   START --<-->  LESS    --< or =--> OPERATOR_END        (<  <<  <=)
+//   START -->-->  GREATER --> or =--> OPERATOR_END        (>  >>  >=)
+//   START --=-->  EQUAL   --=-->    OPERATOR_END          (=  ==)
+//   START --!-->  BANG    --=-->    OPERATOR_END          (!  !=)
+//   START --* / %-->   OPERATOR_END
+//   START --{ } ( ) ; ,--> SYMBOL
+//   START --anything else--> UNKNOWN
+namespace dfa
+{
+	enum CharClass : std::uint8_t { SPACE, LETTER, DIGIT, PLUS_CHAR, MINUS_CHAR, LESS_CHAR, GREATER_CHAR, EQUAL_CHAR, BANG_CHAR, OPERATOR_CHAR, SYMBOL_CHAR, OTHER, CLASS_COUNT };
+
+	enum State : std::uint8_t { START, IDENTIFIER, CONSTANT, PLUS, MINUS, LESS, GREATER, EQUAL, BANG, OPERATOR_END, SYMBOL, UNKNOWN, DEAD, STATE_COUNT };
+
+	constexpr std::array<CharClass, 256> makeCharClasses()
+	{
+		std::array<CharClass, 256> classes = {};
+		for (auto& c : classes) c = OTHER;
+
+		for (unsigned char c : std::string_view(" \t\n\r\f\v")) classes[c] = SPACE;
+		for (int c = 'a'; c <= 'z'; ++c) classes[c] = LETTER;
+		for (int c = 'A'; c <= 'Z'; ++c) classes[c] = LETTER;
+		for (int c = '0'; c <= '9'; ++c) classes[c] = DIGIT;
+		for (unsigned char c : std::string_view("*/%")) classes[c] = OPERATOR_CHAR;
+		for (unsigned char c : std::string_view("{}();,")) classes[c] = SYMBOL_CHAR;
+
+		classes['_'] = LETTER;
+		classes['+'] = PLUS_CHAR;
+		classes['-'] = MINUS_CHAR;
+		classes['<'] = LESS_CHAR;
+		classes['>'] = GREATER_CHAR;
+		classes['='] = EQUAL_CHAR;
+		classes['!'] = BANG_CHAR;
+		return classes;
+	}
+
+	constexpr std::array<std::array<State, CLASS_COUNT>, STATE_COUNT> makeTransitions()
+	{
+		std::array<std::array<State, CLASS_COUNT>, STATE_COUNT> next = {};
+		for (auto& row : next)
+		{
+			for (auto& state : row) state = DEAD;
+		}
+
+		next[START] = { DEAD, IDENTIFIER, CONSTANT, PLUS, MINUS, LESS, GREATER, EQUAL, BANG, OPERATOR_END, SYMBOL, UNKNOWN };
+
+		next[IDENTIFIER][LETTER] = IDENTIFIER;
+		next[IDENTIFIER][DIGIT]  = IDENTIFIER;
+		next[CONSTANT][DIGIT]    = CONSTANT;
+
+		next[PLUS][PLUS_CHAR]       = OPERATOR_END;
+		next[MINUS][MINUS_CHAR]     = OPERATOR_END;
+		next[LESS][LESS_CHAR]       = OPERATOR_END;
+		next[LESS][EQUAL_CHAR]      = OPERATOR_END;
+		next[GREATER][GREATER_CHAR] = OPERATOR_END;
+		next[GREATER][EQUAL_CHAR]   = OPERATOR_END;
+		next[EQUAL][EQUAL_CHAR]     = OPERATOR_END;
+		next[BANG][EQUAL_CHAR]      = OPERATOR_END;
+		return next;
+	}
+
+	constexpr std::array<TokenKind, STATE_COUNT> makeAcceptedKinds()
+	{
+		std::array<TokenKind, STATE_COUNT> kinds = {};
+		for (auto& kind : kinds) kind = TokenKind::Operator;
+
+		kinds[IDENTIFIER] = TokenKind::Identifier;
+		kinds[CONSTANT]   = TokenKind::Constant;
+		kinds[SYMBOL]     = TokenKind::Symbol;
+		kinds[UNKNOWN]    = TokenKind::Unknown;
+		return kinds;
+	}
+
+	inline constexpr auto charClass    = makeCharClasses();
+	inline constexpr auto transition   = makeTransitions();
+	inline constexpr auto acceptedKind = makeAcceptedKinds();	// the kind of token read when the machine stops in a state
+
+
+
+
+	// Classifying bytes a block at a time.
+	//
+	// Most of a source file is whitespace, identifiers, and numbers, and where each of those runs ends is decided by the class of
+	// one byte alone.  So rather than step the machine a byte at a time, these find the end of a run 16 bytes at a time with SSE2
+	// (32 with AVX2), testing each byte's class with a few compares.  The byte by byte table lookup finishes any tail shorter than
+	// a block, and does all of the work where there's no SSE2 or at compile time.  Only the short, ambiguous tokens, telling ++
+	// from + or << from <, are left to the transition table.
+	enum class Run { Space, Identifier, Digits };
+
+	template <Run run>
+	constexpr bool inRun(char c)
+	{
+		CharClass byteClass = charClass[static_cast<unsigned char>(c)];
+		if constexpr (run == Run::Space)      return byteClass == SPACE;
+		if constexpr (run == Run::Identifier) return byteClass == LETTER || byteClass == DIGIT;
+		if constexpr (run == Run::Digits)     return byteClass == DIGIT;
+	}
+
+#if defined(__AVX2__)
+	using Block = __m256i;
+	inline Block load(const char* p)                    { return _mm256_loadu_si256(reinterpret_cast<const Block*>(p)); }
+	inline Block splat(char c)                          { return _mm256_set1_epi8(c); }
+	inline Block equal(Block a, Block b)                { return _mm256_cmpeq_epi8(a, b); }
+	inline Block either(Block a, Block b)               { return _mm256_or_si256(a, b); }
+	inline Block atMost(Block a, char limit)            { return equal(_mm256_min_epu8(a, splat(limit)), a); }	// unsigned a <= limit
+	inline Block minus(Block a, char c)                 { return _mm256_sub_epi8(a, splat(c)); }
+	inline std::uint32_t bits(Block a)                  { return static_cast<std::uint32_t>(_mm256_movemask_epi8(a)); }
+#elif defined(__SSE2__)
+	using Block = __m128i;
+	inline Block load(const char* p)                    { return _mm_loadu_si128(reinterpret_cast<const Block*>(p)); }
+	inline Block splat(char c)                          { return _mm_set1_epi8(c); }
+	inline Block equal(Block a, Block b)                { return _mm_cmpeq_epi8(a, b); }
+	inline Block either(Block a, Block b)               { return _mm_or_si128(a, b); }
+	inline Block atMost(Block a, char limit)            { return equal(_mm_min_epu8(a, splat(limit)), a); }		// unsigned a <= limit
+	inline Block minus(Block a, char c)                 { return _mm_sub_epi8(a, splat(c)); }
+	inline std::uint32_t bits(Block a)                  { return static_cast<std::uint32_t>(_mm_movemask_epi8(a)); }
+#endif
+
+#if defined(__SSE2__)
+	constexpr std::size_t blockSize = sizeof(Block);
+	constexpr std::uint32_t allBits = blockSize == 32 ? 0xFFFFFFFFu : 0xFFFFu;
+
+	// One bit per byte of the block, set for the bytes that belong to the run.  These match the character class table exactly.
+	template <Run run>
+	inline std::uint32_t runBits(Block bytes)
+	{
+		Block digits = atMost(minus(bytes, '0'), 9);
+		if constexpr (run == Run::Digits) return bits(digits);
+
+		if constexpr (run == Run::Identifier)
+		{
+			Block letters = atMost(minus(either(bytes, splat(0x20)), 'a'), 'z' - 'a');	// folds upper case onto lower case
+			return bits(either(either(letters, digits), equal(bytes, splat('_'))));
+		}
+
+		if constexpr (run == Run::Space) return bits(either(equal(bytes, splat(' ')), atMost(minus(bytes, '\t'), '\r' - '\t')));
+	}
+#endif
+
+	// Returns the first byte in [first, last) that isn't part of the run
+	template <Run run>
+	constexpr const char* endOfRun(const char* first, const char* last)
+	{
+#if defined(__SSE2__)
+		if (!std::is_constant_evaluated())
+		{
+			for (; last - first >= static_cast<std::ptrdiff_t>(blockSize); first += blockSize)
+			{
+				std::uint32_t outside = ~runBits<run>(load(first)) & allBits;
+				if (outside != 0) return first + std::countr_zero(outside);
+			}
+		}
+#endif
+		while (first != last && inRun<run>(*first)) ++first;
+		return first;
+	}
+
+	// Skips whitespace, keeping position up to date, and returns the first byte in [first, last) that isn't whitespace
+	constexpr const char* skipSpaces(const char* first, const char* last, SourcePosition& position)
+	{
+		const char* stop = endOfRun<Run::Space>(first, last);
+
+		// Whitespace runs are short, and only the newlines in them matter
+		const char* lineStart = nullptr;
+		for (const char* c = first; c != stop; ++c)
+		{
+			if (*c == '\n')
+			{
+				++position.line;
+				lineStart = c + 1;
+			}
+		}
+		position.column = lineStart == nullptr ? position.column + (stop - first) : 1 + (stop - lineStart);
+		return stop;
+	}
+
+	// Runs the machine from START over [first, last) and returns where it stopped, leaving the last state it was in in state.
+	// A return of last means the token might continue in more input.
+	constexpr const char* longestMatch(const char* first, const char* last, State& state)
+	{
+		state = START;
+		for (; first != last; ++first)
+		{
+			State following = transition[state][charClass[static_cast<unsigned char>(*first)]];
+			if (following == DEAD) break;
+			state = following;
+
+			// Identifiers and constants only ever loop back on themselves, so the block scan finds where they end
+			if (state == IDENTIFIER) return endOfRun<Run::Identifier>(first + 1, last);
+			if (state == CONSTANT)   return endOfRun<Run::Digits>(first + 1, last);
+		}
+		return first;
+	}
+
+	constexpr Token makeToken(State state, std::string_view lexeme, SourcePosition position)
+	{
+		TokenKind kind = acceptedKind[state];
+		if (kind == TokenKind::Identifier && isKeyword(lexeme)) kind = TokenKind::Keyword;
+		return { kind, lexeme, position };
+	}
+}
+
+
+
+
+// Lets a range-for loop pull tokens from anything with a bool next(Token&) member, one at a time:
+//		for (const Token& token : lexer) ...
+template <typename Source>
+class TokenIterator
+{
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type        = Token;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = const Token*;
+	using reference         = const Token&;
+
+	TokenIterator() = default;
+	explicit TokenIterator(Source& tokens) : source(&tokens) { ++*this; }
+
+	const Token& operator*()  const { return current; }
+	const Token* operator->() const { return &current; }
+
+	TokenIterator& operator++()
+	{
+		if (!source->next(current)) source = nullptr;
+		return *this;
+	}
+	void operator++(int) { ++*this; }
+
+	friend bool operator==(const TokenIterator& it, std::default_sentinel_t) { return it.source == nullptr; }
+
+private:
+	Source* source = nullptr;
+	Token   current;
+};
+
+
+
+
+// Splits source text that is already in memory into tokens in a single pass, in source order
+class Lexer
+{
+public:
+	// start is where source begins in a larger text, for lexing a piece of one
+	explicit constexpr Lexer(std::string_view source, SourcePosition start = {}) : text(source), where(start) {}
+
+	// Reads the next token, returning false once the input is used up
+	constexpr bool next(Token& token)
+	{
+		position = dfa::skipSpaces(text.data() + position, text.data() + text.size(), where) - text.data();
+		if (position == text.size()) return false;
+
+		dfa::State  state;
+		std::size_t start = position;
+		position = dfa::longestMatch(text.data() + start, text.data() + text.size(), state) - text.data();
+
+		token = dfa::makeToken(state, text.substr(start, position - start), where);
+		where.column += position - start;	// tokens never span lines
+		return true;
+	}
+
+	TokenIterator<Lexer>    begin() { return TokenIterator<Lexer>(*this); }
+	std::default_sentinel_t end()   { return {}; }
+
+private:
+	std::string_view text;
+	std::size_t      position = 0;
+	SourcePosition   where;
+};
+
+
+
+
+// Pulls tokens from a stream a chunk at a time, so a source of any size is lexed in the memory of one chunk (plus the longest
+// token, should one be longer than a chunk).  Each token's lexeme points into the chunk and is valid until the next token is read;
+// copy it to keep it.
+class TokenStream
+{
+public:
+	static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+	explicit TokenStream(std::istream& source, std::size_t chunkSize = defaultChunkSize) : input(source), buffer(chunkSize == 0 ? 1 : chunkSize) {}
+
+	// Reads the next token, returning false once the input is used up
+	bool next(Token& token)
+	{
+		for (;;)
+		{
+			first = dfa::skipSpaces(buffer.data() + first, buffer.data() + last, where) - buffer.data();
+			if (first == last)
+			{
+				if (!refill()) return false;
+				continue;
+			}
+
+			dfa::State  state;
+			const char* stop = dfa::longestMatch(buffer.data() + first, buffer.data() + last, state);
+
+			// The token runs into the end of the chunk, so it may go on in the next one.  Read more and match it again from its start.
+			if (stop == buffer.data() + last && !atEnd)
+			{
+				refill();
+				continue;
+			}
+
+			std::size_t length = stop - (buffer.data() + first);
+			token = dfa::makeToken(state, std::string_view(buffer.data() + first, length), where);
+			where.column += length;
+			first += length;
+			return true;
+		}
+	}
+
+	TokenIterator<TokenStream> begin() { return TokenIterator<TokenStream>(*this); }
+	std::default_sentinel_t    end()   { return {}; }
+
+private:
+	// Moves the unread part of the chunk to the front and fills the rest from the input, returning false if nothing more was read
+	bool refill()
+	{
+		std::size_t unread = last - first;
+		if (unread == buffer.size()) buffer.resize(buffer.size() * 2);
+		std::copy(buffer.begin() + first, buffer.begin() + last, buffer.begin());
+		first = 0;
+		last  = unread;
+
+		input.read(buffer.data() + last, buffer.size() - last);
+		std::size_t count = static_cast<std::size_t>(input.gcount());
+		last += count;
+		if (count == 0) atEnd = true;
+		return count != 0;
+	}
+
+	std::istream&     input;
+	std::vector<char> buffer;
+	std::size_t       first = 0;	// the unread part of the chunk is [first, last)
+	std::size_t       last  = 0;
+	bool              atEnd = false;
+	SourcePosition    where;
+};
+
+#endif
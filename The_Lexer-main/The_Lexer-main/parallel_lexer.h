@@ -0,0 +1,158 @@
+#ifndef PARALLEL_LEXER_H
+#define PARALLEL_LEXER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "lexer.h"
+
+// Lexing a large source on every core.
+//
+// The text is cut into blocks of about blockSize bytes, each ending just after a newline.  The language has no strings or comments
+// and no token spans a line, so a newline is always a safe place to cut.  A first parallel pass counts the newlines in each block,
+// which gives every block the line it starts on.  Then the worker threads lex blocks, taking the next one as they finish the last,
+// while the calling thread hands each block's tokens to the consumer in source order.  Only a window of a few blocks per thread
+// is ever lexed ahead of the consumer, so memory stays bounded however large the text.
+//
+// consume is called as consume(std::span<const Token>) on the calling thread, once per block, in order.  The lexemes point into
+// text.  If consume throws, the workers are stopped and the exception is passed on.
+namespace parallel
+{
+	constexpr std::size_t defaultBlockSize = 64 * 1024;
+
+	// The ends of the blocks, each just past a newline (or the end of the text)
+	inline std::vector<std::size_t> blockEnds(std::string_view text, std::size_t blockSize)
+	{
+		std::vector<std::size_t> ends;
+		std::size_t end = 0;
+		while (end < text.size())
+		{
+			std::size_t newline = text.find('\n', std::min(end + blockSize, text.size()) - 1);
+			end = newline == std::string_view::npos ? text.size() : newline + 1;
+			ends.push_back(end);
+		}
+		return ends;
+	}
+
+	// Runs work(i) for i in [0, count) across threads, including the calling thread
+	template <typename Work>
+	void forEach(std::size_t count, unsigned threads, Work&& work)
+	{
+		std::atomic<std::size_t> next = 0;
+		auto worker = [&]
+		{
+			for (std::size_t i = next++; i < count; i = next++) work(i);
+		};
+
+		std::vector<std::jthread> helpers;
+		for (unsigned t = 1; t < threads; ++t) helpers.emplace_back(worker);
+		worker();
+	}
+
+	template <typename Consumer>
+	void lex(std::string_view text, Consumer&& consume, unsigned threads = std::thread::hardware_concurrency(), std::size_t blockSize = defaultBlockSize)
+	{
+		threads   = std::max(threads, 1u);
+		blockSize = std::max<std::size_t>(blockSize, 1);
+
+		std::vector<std::size_t> ends = blockEnds(text, blockSize);
+		std::size_t blocks = ends.size();
+		auto blockText = [&](std::size_t i)
+		{
+			std::size_t begin = i == 0 ? 0 : ends[i - 1];
+			return text.substr(begin, ends[i] - begin);
+		};
+
+		// Every block after the first starts at the beginning of a line, so a count of newlines is all its position needs
+		std::vector<std::size_t> firstLine(blocks + 1, 1);
+		forEach(blocks, threads, [&](std::size_t i)
+		{
+			std::string_view block = blockText(i);
+			firstLine[i + 1] = static_cast<std::size_t>(std::count(block.begin(), block.end(), '\n'));
+		});
+		for (std::size_t i = 1; i <= blocks; ++i) firstLine[i] += firstLine[i - 1];
+
+		if (threads == 1)
+		{
+			std::vector<Token> tokens;
+			for (std::size_t i = 0; i < blocks; ++i)
+			{
+				tokens.clear();
+				for (const Token& token : Lexer(blockText(i), { firstLine[i], 1 })) tokens.push_back(token);
+				consume(std::span<const Token>(tokens));
+			}
+			return;
+		}
+
+		// Block i is lexed into slot i % window once block i - window has been consumed.  A slot's filled count says which block's
+		// tokens it holds (block number plus one), and consumed counts blocks handed to the consumer; threads wait on whichever
+		// of those they need to move.
+		struct Slot
+		{
+			std::vector<Token>       tokens;
+			std::atomic<std::size_t> filled = 0;
+		};
+
+		std::size_t                 window = 4 * static_cast<std::size_t>(threads);
+		std::unique_ptr<Slot[]>     slots(new Slot[window]);
+		std::atomic<std::size_t>    next     = 0;
+		std::atomic<std::size_t>    consumed = 0;
+		std::atomic<bool>           stopping = false;
+
+		auto worker = [&]
+		{
+			for (std::size_t i = next++; i < blocks; i = next++)
+			{
+				for (std::size_t seen = consumed.load(); i >= seen + window; seen = consumed.load())
+				{
+					if (stopping) return;
+					consumed.wait(seen);
+				}
+				if (stopping) return;
+
+				Slot& slot = slots[i % window];
+				slot.tokens.clear();
+				for (const Token& token : Lexer(blockText(i), { firstLine[i], 1 })) slot.tokens.push_back(token);
+
+				slot.filled.store(i + 1, std::memory_order_release);
+				slot.filled.notify_one();
+			}
+		};
+
+		std::vector<std::jthread> workers;
+		for (unsigned t = 0; t < threads; ++t) workers.emplace_back(worker);
+
+		try
+		{
+			for (std::size_t i = 0; i < blocks; ++i)
+			{
+				Slot& slot = slots[i % window];
+				for (std::size_t filled = slot.filled.load(std::memory_order_acquire); filled != i + 1; filled = slot.filled.load(std::memory_order_acquire))
+				{
+					slot.filled.wait(filled, std::memory_order_acquire);
+				}
+
+				consume(std::span<const Token>(slot.tokens));
+
+				consumed.store(i + 1);
+				consumed.notify_all();
+			}
+		}
+		catch (...)
+		{
+			stopping = true;
+			consumed.store(blocks + window);	// wakes any worker waiting for room
+			consumed.notify_all();
+			throw;									// the workers finish the block in hand and are joined on the way out
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef AST_ARENA_H
+#define AST_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Syntax trees for the arithmetic expressions, kept in one growing array.
+//
+// Nodes refer to their children by index into the array rather than by pointer, and clear() empties the array without giving
+// its memory back, so once the arena has grown to fit the largest expression it is asked to hold, building more trees allocates
+// nothing.  The parser builds bottom up, so every node is added after its children: walking the array from the front visits
+// children before parents, which is all evaluate() needs to work without recursion or a stack.
+class ExpressionArena {
+public:
+  using Index = std::uint32_t;
+  using Value = std::int64_t;
+
+  enum class Operator : std::uint8_t { VALUE, ADD, MULTIPLY };
+
+  struct Node {
+    Value     value = 0;   // the operand, for a VALUE node
+    Index     left  = 0;
+    Index     right = 0;
+    Operator  op    = Operator::VALUE;
+  };
+
+  Index leaf(Value value) {
+    nodes.push_back({value, 0, 0, Operator::VALUE});
+    return static_cast<Index>(nodes.size() - 1);
+  }
+
+  Index add(Index left, Index right) {
+    nodes.push_back({0, left, right, Operator::ADD});
+    return static_cast<Index>(nodes.size() - 1);
+  }
+
+  Index multiply(Index left, Index right) {
+    nodes.push_back({0, left, right, Operator::MULTIPLY});
+    return static_cast<Index>(nodes.size() - 1);
+  }
+
+  // The value of the tree rooted at root.  Arithmetic wraps around on overflow, as unsigned arithmetic does.
+  Value evaluate(Index root) {
+    results.resize(nodes.size());
+    for (Index i = 0; i <= root; ++i) {
+      const Node &node = nodes[i];
+      auto left  = [&] { return static_cast<std::uint64_t>(results[node.left]);  };
+      auto right = [&] { return static_cast<std::uint64_t>(results[node.right]); };
+      switch (node.op) {
+        case Operator::VALUE:
+        default:                 results[i] = node.value;                             break;
+        case Operator::ADD:      results[i] = static_cast<Value>(left() + right());   break;
+        case Operator::MULTIPLY: results[i] = static_cast<Value>(left() * right());   break;
+      }
+    }
+    return results[root];
+  }
+
+  const Node &operator[](Index index) const { return nodes[index]; }
+
+  std::size_t size()     const { return nodes.size(); }
+  std::size_t capacity() const { return nodes.capacity(); }
+
+  // Forgets every tree, keeping the memory for the next
+  void clear() { nodes.clear(); }
+
+private:
+  std::vector<Node>  nodes;
+  std::vector<Value> results;   // evaluate()'s scratch space, reused like the nodes
+};
+
+#endif
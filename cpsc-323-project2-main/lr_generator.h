@@ -0,0 +1,350 @@
+#ifndef LR_GENERATOR_H
+#define LR_GENERATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// An SLR(1) parser generator that runs in the compiler.
+//
+// A grammar is declared as constexpr data: an enum of terminals, an enum of nonterminals, and a list of rules over them.
+// makeTables builds the LR(0) item sets and the FOLLOW sets and fills in the ACTION and GOTO tables during constant evaluation,
+// so the tables end up in the program just as a hand-written table would, and nothing is built at run time.  A grammar that
+// isn't SLR(1) doesn't compile; the error points at the conflict.
+//
+// The enums follow slr_table.h: Terminal ends with TERMINAL_COUNT and NonTerminal with NONTERMINAL_COUNT.
+namespace lr {
+
+enum class ActionType : std::uint8_t { ERROR, SHIFT, REDUCE, ACCEPT };
+
+struct Action {
+  ActionType    type  = ActionType::ERROR;
+  std::uint8_t  value = 0;   // the state to shift to, or the rule to reduce by
+
+  friend constexpr bool operator==(Action, Action) = default;
+};
+
+constexpr Action s(std::uint8_t state) { return {ActionType::SHIFT, state}; }
+constexpr Action r(std::uint8_t rule)  { return {ActionType::REDUCE, rule}; }
+constexpr Action acc = {ActionType::ACCEPT, 0};
+constexpr Action err = {};
+
+// A grammar symbol: terminal t is t itself, nonterminal n is TERMINAL_COUNT + n
+using Symbol = std::uint8_t;
+
+constexpr std::size_t MAX_RULE_LENGTH = 8;
+
+template <typename Terminal, typename NonTerminal>
+struct Rule {
+  NonTerminal                          left;
+  std::uint8_t                         length = 0;   // how many symbols the right side has, the number of states a reduction pops
+  std::array<Symbol, MAX_RULE_LENGTH>  right  = {};
+
+  // Written as the left side followed by the right, e.g. {E, E, PLUS, T} for E -> E + T
+  template <typename... Right>
+  constexpr Rule(NonTerminal leftSide, Right... symbols) : left(leftSide), length(sizeof...(Right)), right{symbol(symbols)...} {
+    static_assert(sizeof...(Right) <= MAX_RULE_LENGTH, "raise MAX_RULE_LENGTH for longer rules");
+  }
+
+  static constexpr Symbol symbol(Terminal terminal)       { return terminal; }
+  static constexpr Symbol symbol(NonTerminal nonTerminal) { return static_cast<Symbol>(std::size_t(Terminal::TERMINAL_COUNT) + nonTerminal); }
+};
+
+template <typename Terminal, typename NonTerminal, std::size_t RuleCount>
+struct Grammar {
+  static constexpr std::size_t TERMINALS    = Terminal::TERMINAL_COUNT;
+  static constexpr std::size_t NONTERMINALS = NonTerminal::NONTERMINAL_COUNT;
+  static constexpr std::size_t RULES        = RuleCount;
+
+  static_assert(TERMINALS <= 64, "terminal sets are kept as 64 bit masks");
+
+  std::array<const char *, TERMINALS>                 terminalNames;
+  std::array<const char *, NONTERMINALS>              nonTerminalNames;
+  Terminal                                            end;     // the end marker
+  std::array<Rule<Terminal, NonTerminal>, RuleCount>  rules;   // rules[0] is the augmented start rule S' -> S, written as S -> S
+
+  static constexpr bool isTerminal(Symbol symbol) { return symbol < TERMINALS; }
+
+  constexpr const char *name(Symbol symbol) const {
+    return isTerminal(symbol) ? terminalNames[symbol] : nonTerminalNames[symbol - TERMINALS];
+  }
+
+  // The right side of a rule, for printing
+  std::string text(std::size_t rule) const {
+    std::string text;
+    for (std::size_t i = 0; i < rules[rule].length; ++i) {
+      if (i > 0) text += ' ';
+      text += name(rules[rule].right[i]);
+    }
+    return text;
+  }
+};
+
+template <typename G, std::size_t StateCount>
+struct Tables {
+  // ACTION is indexed by state and terminal, GOTO by state and nonterminal.  A GOTO entry of 0 is one the parse never reaches,
+  // as no state goes back to state 0.
+  std::array<std::array<Action, G::TERMINALS>, StateCount>           actionTable = {};
+  std::array<std::array<std::uint8_t, G::NONTERMINALS>, StateCount>  gotoTable   = {};
+};
+
+namespace detail {
+
+struct Item {
+  std::uint8_t rule;
+  std::uint8_t dot;   // how many symbols of the right side are behind the dot
+
+  friend constexpr bool operator==(Item, Item) = default;
+};
+
+template <typename G>
+struct Automaton {
+  std::vector<std::vector<Item>>                                      kernels;       // the items that define each state
+  std::vector<std::array<int, G::TERMINALS + G::NONTERMINALS>>        transitions;   // the state after each symbol, or -1
+};
+
+template <typename G>
+constexpr std::vector<Item> closure(const G &grammar, const std::vector<Item> &kernel) {
+  std::vector<Item>                  items = kernel;
+  std::array<bool, G::NONTERMINALS>  added = {};
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    const auto &rule = grammar.rules[items[i].rule];
+    if (items[i].dot == rule.length || G::isTerminal(rule.right[items[i].dot])) continue;
+
+    std::size_t next = rule.right[items[i].dot] - G::TERMINALS;
+    if (added[next]) continue;
+    added[next] = true;
+    for (std::size_t r = 1; r < G::RULES; ++r) {   // never rule 0, whose left side is really S'
+      if (static_cast<std::size_t>(grammar.rules[r].left) == next) items.push_back({static_cast<std::uint8_t>(r), 0});
+    }
+  }
+  return items;
+}
+
+constexpr bool sameItems(const std::vector<Item> &a, const std::vector<Item> &b) {
+  if (a.size() != b.size()) return false;
+  for (Item item : a) {
+    bool found = false;
+    for (Item other : b) found = found || item == other;
+    if (!found) return false;
+  }
+  return true;
+}
+
+// The canonical collection of LR(0) item sets.  States are numbered in the order they are found, and each state's transitions in
+// the order their symbols first follow a dot, which numbers the expression grammar's states as the textbook does.
+template <typename G>
+constexpr Automaton<G> buildAutomaton(const G &grammar) {
+  Automaton<G> automaton;
+  automaton.kernels.push_back({Item{0, 0}});
+
+  for (std::size_t state = 0; state < automaton.kernels.size(); ++state) {
+    std::vector<Item> items = closure(grammar, automaton.kernels[state]);
+
+    std::array<int, G::TERMINALS + G::NONTERMINALS> transitions;
+    transitions.fill(-1);
+    for (Item item : items) {
+      const auto &rule = grammar.rules[item.rule];
+      if (item.dot == rule.length || transitions[rule.right[item.dot]] != -1) continue;
+
+      Symbol symbol = rule.right[item.dot];
+      std::vector<Item> kernel;
+      for (Item other : items) {
+        const auto &otherRule = grammar.rules[other.rule];
+        if (other.dot < otherRule.length && otherRule.right[other.dot] == symbol) kernel.push_back({other.rule, static_cast<std::uint8_t>(other.dot + 1)});
+      }
+
+      std::size_t target = 0;
+      while (target < automaton.kernels.size() && !sameItems(automaton.kernels[target], kernel)) ++target;
+      if (target == automaton.kernels.size()) automaton.kernels.push_back(kernel);
+      transitions[symbol] = static_cast<int>(target);
+    }
+    automaton.transitions.push_back(transitions);
+  }
+  return automaton;
+}
+
+constexpr std::uint64_t bit(Symbol terminal) { return std::uint64_t(1) << terminal; }
+
+// FOLLOW of each nonterminal as a set of terminals, by way of nullable and FIRST, each grown until it stops changing
+template <typename G>
+constexpr std::array<std::uint64_t, G::NONTERMINALS> followSets(const G &grammar) {
+  std::array<bool, G::NONTERMINALS>           nullable = {};
+  std::array<std::uint64_t, G::NONTERMINALS>  first    = {};
+  std::array<std::uint64_t, G::NONTERMINALS>  follow   = {};
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (const auto &rule : grammar.rules) {
+      std::uint64_t  set   = first[rule.left];
+      bool           empty = true;
+      for (std::size_t i = 0; i < rule.length && empty; ++i) {
+        Symbol symbol = rule.right[i];
+        if (G::isTerminal(symbol)) {
+          set  |= bit(symbol);
+          empty = false;
+        }
+        else {
+          set  |= first[symbol - G::TERMINALS];
+          empty = nullable[symbol - G::TERMINALS];
+        }
+      }
+      if (set != first[rule.left] || (empty && !nullable[rule.left])) {
+        first[rule.left]    = set;
+        nullable[rule.left] = nullable[rule.left] || empty;
+        changed = true;
+      }
+    }
+  }
+
+  follow[grammar.rules[0].left] = bit(grammar.end);
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (const auto &rule : grammar.rules) {
+      std::uint64_t trailer = follow[rule.left];   // what can follow the part of the right side after position i
+      for (std::size_t i = rule.length; i-- > 0;) {
+        Symbol symbol = rule.right[i];
+        if (G::isTerminal(symbol)) {
+          trailer = bit(symbol);
+          continue;
+        }
+        std::size_t n = symbol - G::TERMINALS;
+        if ((follow[n] | trailer) != follow[n]) {
+          follow[n] |= trailer;
+          changed = true;
+        }
+        trailer = nullable[n] ? trailer | first[n] : first[n];
+      }
+    }
+  }
+  return follow;
+}
+
+}  // namespace detail
+
+// How many states the grammar's automaton has, the size of its tables
+template <typename G>
+constexpr std::size_t stateCount(const G &grammar) {
+  return detail::buildAutomaton(grammar).kernels.size();
+}
+
+// The SLR(1) tables for the grammar, meant for a constexpr variable: lr::makeTables<lr::stateCount(grammar)>(grammar)
+template <std::size_t StateCount, typename G>
+constexpr Tables<G, StateCount> makeTables(const G &grammar) {
+  static_assert(StateCount <= 256, "states are numbered in a byte");
+  static_assert(G::RULES <= 256, "rules are numbered in a byte");
+
+  detail::Automaton<G>                        automaton = detail::buildAutomaton(grammar);
+  std::array<std::uint64_t, G::NONTERMINALS>  follow    = detail::followSets(grammar);
+  if (automaton.kernels.size() != StateCount) throw "StateCount must be stateCount(grammar)";
+
+  Tables<G, StateCount> tables;
+  auto set = [&](Action &entry, Action action) {
+    if (entry != err && entry != action) throw "the grammar is not SLR(1): two actions for one table entry";
+    entry = action;
+  };
+
+  for (std::size_t state = 0; state < StateCount; ++state) {
+    for (std::size_t symbol = 0; symbol < G::TERMINALS + G::NONTERMINALS; ++symbol) {
+      int target = automaton.transitions[state][symbol];
+      if (target == -1) continue;
+      if (G::isTerminal(static_cast<Symbol>(symbol)))
+        set(tables.actionTable[state][symbol], s(static_cast<std::uint8_t>(target)));
+      else
+        tables.gotoTable[state][symbol - G::TERMINALS] = static_cast<std::uint8_t>(target);
+    }
+
+    for (detail::Item item : detail::closure(grammar, automaton.kernels[state])) {
+      const auto &rule = grammar.rules[item.rule];
+      if (item.dot != rule.length) continue;
+      if (item.rule == 0) {
+        set(tables.actionTable[state][grammar.end], acc);
+        continue;
+      }
+      for (std::size_t terminal = 0; terminal < G::TERMINALS; ++terminal) {
+        if (follow[rule.left] & detail::bit(static_cast<Symbol>(terminal))) set(tables.actionTable[state][terminal], r(item.rule));
+      }
+    }
+  }
+  return tables;
+}
+
+// A table driven recognizer for a generated grammar.  The input is given either all at once to accepts(), or a terminal at a
+// time to push(), for input that arrives in pieces.  push() can also be given an observer, which sees every action the parse
+// takes, for callers that trace the parse or build something as it reduces.
+template <typename G, std::size_t StateCount>
+class Recognizer {
+public:
+  enum class Status : std::uint8_t { READING, ACCEPTED, REJECTED };
+
+private:
+  const G                          &grammar;
+  const Tables<G, StateCount>      &tables;
+  std::vector<std::uint8_t>         stack;   // kept between parses so its memory is reused
+  Status                            status = Status::READING;
+
+public:
+  Recognizer(const G &forGrammar, const Tables<G, StateCount> &withTables) : grammar(forGrammar), tables(withTables) {
+    reset();
+  }
+
+  // Starts a new parse
+  void reset() {
+    stack.clear();
+    stack.push_back(0);
+    status = Status::READING;
+  }
+
+  // Takes the next terminal, making every reduction it calls for and then shifting it, and says where the parse stands.  The end
+  // marker finishes the parse; anything after that is rejected.
+  Status push(Symbol terminal) {
+    return push(terminal, [](Action) {});
+  }
+
+  // The same, passing each action to observe before it's taken: the reductions, then the shift, accept, or error that ends the
+  // step.  A push after the parse has finished takes no action, so observe isn't called.
+  template <typename Observer>
+  Status push(Symbol terminal, Observer &&observe) {
+    if (status != Status::READING) return status = Status::REJECTED;
+    while (true) {
+      Action action = terminal < G::TERMINALS ? tables.actionTable[stack.back()][terminal] : err;
+      observe(action);
+      switch (action.type) {
+        case ActionType::SHIFT:
+          stack.push_back(action.value);
+          return status;
+
+        case ActionType::REDUCE: {
+          const auto &rule = grammar.rules[action.value];
+          stack.erase(stack.end() - rule.length, stack.end());
+          stack.push_back(tables.gotoTable[stack.back()][rule.left]);
+          break;
+        }
+
+        case ActionType::ACCEPT:
+          return status = Status::ACCEPTED;
+
+        case ActionType::ERROR:
+        default:
+          return status = Status::REJECTED;
+      }
+    }
+  }
+
+  // Whether the grammar derives the input, a sequence of terminals that may leave off the end marker
+  bool accepts(std::span<const Symbol> input) {
+    reset();
+    for (Symbol terminal : input) {
+      if (push(terminal) == Status::REJECTED) return false;
+    }
+    if (status == Status::READING) push(grammar.end);
+    return status == Status::ACCEPTED;
+  }
+};
+
+}  // namespace lr
+
+#endif
@@ -1,175 +1,335 @@
 #include <iostream>
-#include <stack>
 #include <string>
+#include <string_view>
 #include <iomanip>
 #include <vector>
-
-struct GrammarRule {
-  char nonTerminal;
-  std::vector<char> production;
-};
+#include <chrono>
+#include <fstream>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include "slr_table.h"
+#include "parse_trace.h"
+#include "ast_arena.h"
+#include "statement_grammar.h"
+#include "token_pipeline.h"
 
 class Parser {
 private:
-  std::vector<std::string> stackOutput;
-  std::vector<std::string> inputOutput;
-  std::vector<std::string> actionOutput;
-  int counter = 0;
-
-  std::stack<char> parserStack;
-  std::vector<GrammarRule> grammarRule = {
-    {'E', {'E', '+', 'T'}}, 
-    {'E', {'T'}},           
-    {'T', {'T', '*', 'F'}},
-    {'T', {'F'}},           
-    {'T', {'(', 'E', ')'}}, 
-    {'F', {'i'}},
-  };
+  ParseTrace trace;   // the steps of the last parse, for printOutput
 
-  bool getNextState(const std::vector<char> &rule) {
-    std::vector<char> stackTemp;
-    int count = 1;
+  // The generated tables' recognizer, whose parse stack is kept between parses so its memory is reused
+  slr::Recognizer recognizer{slr::grammar, slr::tables};
 
-    for (int i = 0; i < parserStack.size(); ++i) {
+  // evaluate()'s syntax tree, and the tree node for each symbol on the parse stack (unused for symbols with no node, like + or ( )
+  ExpressionArena                      arena;
+  std::vector<ExpressionArena::Index>  operands;
 
-      if (parserStack.top() == rule[rule.size() - count]) {
-        stackTemp.push_back(parserStack.top());
-        parserStack.pop();
-        ++count;
-      }
+  // Runs the recognizer over the input a character at a time.  Each step makes one ACTION lookup and either shifts, reduces
+  // (popping the handle in one step and looking up one GOTO entry), accepts, or fails, so a parse takes time linear in the length
+  // of the input.  Every action taken is passed to observe, along with the input symbol it was taken on.
+  template <typename Observer>
+  bool run(std::string_view input, Observer &&observe) {
+    recognizer.reset();
 
-      if (count == rule.size()) {
-        for (auto symbol : stackTemp) {
-          parserStack.push(symbol);
-        }
-        return true;
-      }
-    }
+    for (std::size_t position = 0;; ++position) {
+      char symbol = position < input.size() ? input[position] : '$';   // the end marker may be left off
+      bool last   = position + 1 >= input.size();
 
-    for (auto symbol : stackTemp) {
-      parserStack.push(symbol);
-    }
+      auto status = recognizer.push(slr::toTerminal(symbol), [&](slr::Action action) {
+        if (action.type == slr::ActionType::ACCEPT && !last) action = slr::err;   // nothing may follow the end marker
+        observe(action, symbol);
+      });
 
-    return false;
+      if (status == slr::Recognizer::Status::ACCEPTED) return last;
+      if (status == slr::Recognizer::Status::REJECTED) return false;
+    }
   }
 
-  void getStack(){
-    std::vector<char> stackTemp;
-    
-    std::cout << "Current Stack: ";
-    
-    while(!parserStack.empty()) {
-      stackTemp.push_back(parserStack.top());
-      std::cout << parserStack.top() << " ";
-      // stackOutput[counter] += std::to_string(parserStack.top());
-      parserStack.pop();
-    }
-    std::cout << std::endl;
-    while(!stackTemp.empty()) {
-      parserStack.push(stackTemp.back());
-      stackTemp.pop_back();
+  // The semantic action for a reduction by the given rule: replaces the operands of the right side with the left side's node
+  void buildNode(std::uint8_t rule) {
+    switch (rule) {
+      case 1:   // E -> E + T
+      case 3: { // T -> T * F
+        ExpressionArena::Index right = operands.back();
+        operands.pop_back();
+        operands.pop_back();
+        operands.back() = rule == 1 ? arena.add(operands.back(), right) : arena.multiply(operands.back(), right);
+        break;
+      }
+
+      case 5: { // F -> ( E )
+        operands.pop_back();
+        ExpressionArena::Index inner = operands.back();
+        operands.pop_back();
+        operands.back() = inner;
+        break;
+      }
+
+      default:  // a single symbol right side passes its node up as it is
+        break;
     }
   }
 
 public:
-  // Parser(const std::unordered_map<std::string, std::string>& parsingTable) :
-  // parsingTable(parsingTable) {}
-  bool isNonTerminal(char x) {
-    if (x >= 'A' && x <= 'Z')
-      return false;
+  // Parses a string of grammar symbols such as "(i+i)*i$" and says whether it was accepted.  printOutput shows the steps.
+  bool parse(const std::string &input) {
+    bool accepted = traceParse(input);
+    std::cout << "Fully Parsed: " << input << std::endl;
+    if (accepted)
+      std::cout << "Successfully Parsed" << std::endl;
     else
-      return true;
+      std::cout << "This string is not accepted" << std::endl;
+    return accepted;
   }
 
-  void reduce(const GrammarRule &rule) { // Could also possibly take in the stack as an input
-    // Reduce the top of the stack by the production rule
-    std::cout << "Reducing: " << rule.nonTerminal << " -> ";
-    // actionOutput.push_back("Reduction " + std::to_string(rule.nonTerminal) + " -> ");
-    for (char symbol : rule.production) {
-      std::cout << symbol << " ";
-      // actionOutput[counter] += std::to_string(symbol) + " ";
-      parserStack.pop();
-    }
-    // ++counter;
-    // Push the new top of the stack onto the stack
-    std::cout << std::endl;
-    parserStack.push(rule.nonTerminal);
-    // std::cout << "Current Top of Stack: " << parserStack.top() << std::endl;
-    getStack();
-    getReductionRule();
-  }
-
-  bool isReductionApplicable() {
-    // Placeholder logic for checking if a reduction is applicable
-    return parserStack.top() != '$';
-  }
-
-  void doShift(const std::string& input){
-    std::string temp = input;
-  
-    for (char inputSymbol : input) {
-      std::cout << "Shifting: " << inputSymbol << std::endl;
-      // actionOutput.push_back("Shift");
-      // ++counter;
-      parserStack.push(inputSymbol);
-      // inputOutput.push_back(input);
-
-      while (isReductionApplicable()) {
-        std::cout << "Looping for a reduction: ";
-        getReductionRule();
-        std::cout << std::endl;
-        break;
+  // Parses and records the steps for printOutput, printing nothing.  Recording costs a two byte append per step.
+  bool traceParse(std::string_view input) {
+    trace.start(input);
+    return run(input, [this](slr::Action action, char) { trace.record(action); });
+  }
+
+  // The same parse with no trace kept, for checking many or very long inputs
+  bool accepts(std::string_view input) {
+    return run(input, [](slr::Action, char) {});
+  }
+
+  // Parses an expression and returns its value, or nothing if the input isn't accepted.  The operands are single digits, and i,
+  // which stands for identifierValue.  The tree is built in the arena as the parse reduces, then evaluated.
+  std::optional<ExpressionArena::Value> evaluate(std::string_view input, ExpressionArena::Value identifierValue = 1) {
+    arena.clear();
+    operands.clear();
+
+    bool accepted = run(input, [&](slr::Action action, char symbol) {
+      if (action.type == slr::ActionType::SHIFT) {
+        ExpressionArena::Index node = 0;
+        if (symbol == 'i')                      node = arena.leaf(identifierValue);
+        else if (symbol >= '0' && symbol <= '9') node = arena.leaf(symbol - '0');
+        operands.push_back(node);
       }
-      // temp.erase(temp.begin());
-      if (inputSymbol == '$') {
-        std::cout << "End State encountered!" << std::endl;
-        break;
+      else if (action.type == slr::ActionType::REDUCE) {
+        buildNode(action.value);
       }
+    });
+
+    if (!accepted) return std::nullopt;
+    return arena.evaluate(operands.back());
+  }
+
+  // How many nodes evaluate() can build before its arena must grow
+  std::size_t arenaCapacity() const {
+    return arena.capacity();
+  }
+
+  // Prints the stack, remaining input, and action at each step of the last parse
+  void printOutput() {
+    trace.print(std::cout);
+  }
+};
+
+// Times the parser on expressions of about the given number of tokens, one long and flat and one nested as deep as it is long
+void benchmark(std::size_t tokens) {
+  std::string flat;
+  while (flat.size() < tokens) flat += "(i+i)*i+";
+  flat += "i$";
+
+  std::string nested(tokens / 2, '(');
+  nested += 'i';
+  nested.append(tokens / 2, ')');
+  nested += '$';
+
+  Parser parser;
+  for (const std::string *input : {&flat, &nested}) {
+    for (bool traced : {false, true}) {
+      auto start = std::chrono::steady_clock::now();
+      bool accepted = traced ? parser.traceParse(*input) : parser.accepts(*input);
+      std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+      std::cout << std::setw(8) << (input == &flat ? "flat" : "nested") << std::setw(8) << (traced ? "traced" : "") << std::setw(12) << input->size() << " tokens"
+                << std::fixed << std::setprecision(1) << std::setw(10) << elapsed.count() / 1e6 << " ms"
+                << std::setw(8) << elapsed.count() / input->size() << " ns/token   "
+                << (accepted ? "accepted" : "REJECTED") << std::endl;
     }
   }
+}
 
-  void getReductionRule() {
-    // Placeholder logic for finding the appropriate grammar rule for reduction
-    for (const GrammarRule &rule : grammarRule) {
-      for (char symbol : rule.production) {
-        if (parserStack.top() != rule.production.back())
-          break;
-        else if (parserStack.top() == rule.production.back() && rule.production.size() == 1){
-          reduce(rule);
-        }
-        else if (getNextState(rule.production))
-          reduce(rule);
-      }
+// A random expression over single digit operands, nested at most depth deep
+std::string randomExpression(std::mt19937 &generator, int depth) {
+  switch (depth > 0 ? generator() % 4 : 0) {
+    case 0:  return std::string(1, static_cast<char>('0' + generator() % 10));
+    case 1:  return randomExpression(generator, depth - 1) + '+' + randomExpression(generator, depth - 1);
+    case 2:  return randomExpression(generator, depth - 1) + '*' + randomExpression(generator, depth - 1);
+    default: return '(' + randomExpression(generator, depth - 1) + ')';
+  }
+}
+
+// Times parsing and evaluating many short expressions, after one pass to let the arena grow to fit the largest
+void evaluationBenchmark(std::size_t count) {
+  std::mt19937 generator(323);
+  std::vector<std::string> expressions;
+  std::size_t symbols = 0;
+  for (int i = 0; i < 1000; ++i) {
+    expressions.push_back(randomExpression(generator, 6) + '$');
+    symbols += expressions.back().size();
+  }
+
+  Parser parser;
+  for (const std::string &expression : expressions) parser.evaluate(expression);
+  std::size_t capacity = parser.arenaCapacity();
+
+  std::int64_t total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; ++i) total += parser.evaluate(expressions[i % expressions.size()]).value_or(0);
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << std::setw(12) << count << " expressions (" << symbols / expressions.size() << " symbols on average)"
+            << std::fixed << std::setprecision(1) << std::setw(10) << elapsed.count() / 1e6 << " ms"
+            << std::setw(8) << elapsed.count() / count << " ns/expression   sum " << total
+            << "   arena " << (parser.arenaCapacity() == capacity ? "did not grow" : "GREW") << std::endl;
+}
+
+// Appends a random expression of the statement language, nested at most depth deep
+void randomTerms(std::mt19937 &generator, int depth, std::vector<lr::Symbol> &program) {
+  using namespace statements;
+  switch (depth > 0 ? generator() % 6 : generator() % 2) {
+    case 0:  program.push_back(ID);  break;
+    case 1:  program.push_back(NUM); break;
+    case 2:  program.push_back(MINUS); randomTerms(generator, depth - 1, program); break;
+    case 3:
+      program.push_back(LPAREN);
+      randomTerms(generator, depth - 1, program);
+      program.push_back(RPAREN);
+      break;
+    default: {
+      constexpr Terminal operators[] = {PLUS, MINUS, TIMES, DIVIDE};
+      randomTerms(generator, depth - 1, program);
+      program.push_back(operators[generator() % 4]);
+      randomTerms(generator, depth - 1, program);
     }
   }
+}
 
-  void parse(const std::string &input) {
+// Appends a random statement, with blocks nested at most depth deep
+void randomStatement(std::mt19937 &generator, int depth, std::vector<lr::Symbol> &program) {
+  using namespace statements;
+  auto condition = [&] {
+    program.push_back(LPAREN);
+    randomTerms(generator, 2, program);
+    program.push_back(generator() % 2 ? LESS : EQUAL);
+    randomTerms(generator, 2, program);
+    program.push_back(RPAREN);
+  };
+  auto block = [&] {
+    program.push_back(LBRACE);
+    for (unsigned i = generator() % 4; i > 0; --i) randomStatement(generator, depth - 1, program);
+    program.push_back(RBRACE);
+  };
 
-    // parserStack.push('$');
-    doShift(input);
-    std::cout << "Fully Parsed: " << input << std::endl;
-    // parserStack.pop();
-    if (parserStack.top() == '$')
-      std::cout << "Successfully Parsed" << std::endl;
-    else
-      std::cout << "This string is not accepted";
+  switch (depth > 0 ? generator() % 6 : generator() % 2) {
+    case 0:  program.insert(program.end(), {ID, ASSIGN}); randomTerms(generator, 3, program); program.push_back(SEMICOLON); break;
+    case 1:  program.push_back(PRINT); randomTerms(generator, 3, program); program.push_back(SEMICOLON); break;
+    case 2:  program.push_back(IF); condition(); block(); break;
+    case 3:  program.push_back(IF); condition(); block(); program.push_back(ELSE); block(); break;
+    case 4:  program.push_back(WHILE); condition(); block(); break;
+    default: block();
   }
+}
 
-  void printOutput(){
-    std::cout << std::setw(5) << "Step" << std::setw(10) << "Stack" << std::setw(15) << "Input" << std::setw(20) << "Action" << std::endl;
-    std::cout << "----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------" << std::endl;
-    for (int i = 0; i < counter; ++i) {
-      std::cout << std::setw(5) << i + 1 << std::setw(10) << stackOutput[i] << std::setw(15) << inputOutput[i] << std::setw(20) << actionOutput[i] << std::endl;
+// Times the table driven recognizer the generator gives each grammar, on inputs of about the given number of tokens
+void grammarBenchmark(std::size_t tokens) {
+  std::mt19937 generator(323);
+
+  std::vector<lr::Symbol> expression;
+  while (expression.size() < tokens) {
+    expression.insert(expression.end(), {slr::LPAREN, slr::ID, slr::PLUS, slr::ID, slr::RPAREN, slr::TIMES, slr::ID, slr::PLUS});
+  }
+  expression.insert(expression.end(), {slr::ID, slr::END});
+
+  std::vector<lr::Symbol> program;
+  while (program.size() < tokens) randomStatement(generator, 4, program);
+  program.push_back(statements::END);
+
+  lr::Recognizer expressions(slr::grammar, slr::tables);
+  lr::Recognizer programs(statements::grammar, statements::tables);
+  for (bool statement : {false, true}) {
+    const std::vector<lr::Symbol> &input = statement ? program : expression;
+    auto start = std::chrono::steady_clock::now();
+    bool accepted = statement ? programs.accepts(input) : expressions.accepts(input);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::setw(12) << (statement ? "statements" : "expression") << std::setw(4) << (statement ? statements::STATE_COUNT : slr::STATE_COUNT) << " states"
+              << std::setw(12) << input.size() << " tokens"
+              << std::fixed << std::setprecision(1) << std::setw(10) << elapsed.count() / 1e6 << " ms"
+              << std::setw(8) << elapsed.count() / input.size() << " ns/token   "
+              << (accepted ? "accepted" : "REJECTED") << std::endl;
+  }
+}
+
+// Times lexing source text and parsing the tokens, on one thread and on two, against lexing alone
+void pipelineBenchmark(std::size_t tokens) {
+  std::string source;
+  for (std::size_t count = 0; count < tokens; count += 8) source += "(alpha + 42) * beta7 +\n";
+  source += "x\n";
+
+  for (const char *mode : {"lex only", "fused", "threaded"}) {
+    auto start = std::chrono::steady_clock::now();
+    Lexer lexer(source);
+    pipeline::Result result;
+    if (mode[0] == 'l') {
+      Token token;
+      while (lexer.next(token)) ++result.tokens;
+      result.accepted = true;
+    }
+    else {
+      result = mode[0] == 'f' ? pipeline::parse(lexer) : pipeline::parseThreaded(lexer);
     }
-    
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::setw(12) << mode << std::setw(12) << result.tokens << " tokens"
+              << std::fixed << std::setprecision(1) << std::setw(10) << elapsed.count() / 1e6 << " ms"
+              << std::setw(8) << elapsed.count() / result.tokens << " ns/token   "
+              << (mode[0] == 'l' ? "" : result.accepted ? "accepted" : "REJECTED") << std::endl;
   }
-};
+}
 
-int main() {
+int main(int argc, char *argv[]) {
+  // main --benchmark [tokens, 1000000 by default]
+  if (argc > 1 && std::string_view(argv[1]) == "--benchmark") {
+    std::size_t tokens = argc > 2 ? std::stoull(argv[2]) : 1'000'000;
+    benchmark(tokens);
+    benchmark(tokens * 10);
+    evaluationBenchmark(tokens);
+    grammarBenchmark(tokens);
+    grammarBenchmark(tokens * 10);
+    pipelineBenchmark(tokens * 10);
+    return 0;
+  }
+
+  // main --parse file: lexes the file and parses its tokens as an expression, identifiers and constants standing for i
+  if (argc > 2 && std::string_view(argv[1]) == "--parse") {
+    std::ifstream file(argv[2], std::ios::binary);
+    if (!file) {
+      std::cout << "Cannot open " << argv[2] << std::endl;
+      return 1;
+    }
+    TokenStream tokens(file);
+    pipeline::Result result = pipeline::parseThreaded(tokens);
+    if (result.accepted)
+      std::cout << "Successfully Parsed " << result.tokens << " tokens" << std::endl;
+    else
+      std::cout << "This input is not accepted: stopped at line " << result.position.line << ", column " << result.position.column << std::endl;
+    return result.accepted ? 0 : 1;
+  }
 
   Parser parser;
-  //parser.parse("(i+i)*i$");
-  //parser.parse("i*i$");
-  parser.parse("(id*)");
+  for (const std::string input : {"(i+i)*i$", "i*i$", "(id*)"}) {
+    parser.parse(input);
+    parser.printOutput();
+    std::cout << std::endl;
+  }
+
+  for (const std::string input : {"(1+2)*3$", "2+3*4$", "(i+1)*(i+2)$"}) {
+    std::cout << input << " = " << parser.evaluate(input).value() << std::endl;
+  }
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,113 @@
+#ifndef PARSE_TRACE_H
+#define PARSE_TRACE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "slr_table.h"
+
+// A record of the steps of a parse, cheap enough to keep on every parse.
+//
+// Each step is stored as just the action taken, two bytes appended to a vector.  Everything else about a step follows from the
+// actions before it: a shift pushes the state it names and moves one symbol along the input, and a reduction pops its rule's right
+// side and pushes the GOTO state.  So the stack and input columns of the step table are rebuilt by replaying the actions, and only
+// when the table is printed.
+class ParseTrace {
+private:
+  std::string               input;   // what was parsed, ending with the end marker
+  std::vector<slr::Action>  steps;
+
+  struct Row {
+    std::string stack;
+    std::string remaining;
+    std::string action;
+  };
+
+  std::vector<Row> replay() const {
+    std::vector<Row> rows;
+    rows.reserve(steps.size());
+
+    std::vector<std::uint8_t>  states = {0};
+    std::vector<std::string>   symbols;   // the grammar symbol under each state but the first
+    std::size_t                position = 0;
+
+    for (slr::Action action : steps) {
+      Row row;
+      row.stack = std::to_string(states[0]);
+      for (std::size_t i = 0; i < symbols.size(); ++i) row.stack += symbols[i] + std::to_string(states[i + 1]);
+      row.remaining = input.substr(std::min(position, input.size()));
+
+      switch (action.type) {
+        case slr::ActionType::SHIFT:
+          row.action = "Shift " + std::to_string(action.value);
+          states.push_back(action.value);
+          symbols.emplace_back(1, input[position++]);
+          break;
+
+        case slr::ActionType::REDUCE: {
+          const auto &rule = slr::productions[action.value];
+          row.action = std::string("Reduce ") + slr::grammar.nonTerminalNames[rule.left] + " -> " + slr::grammar.text(action.value);
+          states.erase(states.end() - rule.length, states.end());
+          symbols.erase(symbols.end() - rule.length, symbols.end());
+          states.push_back(slr::gotoTable[states.back()][rule.left]);
+          symbols.emplace_back(slr::grammar.nonTerminalNames[rule.left]);
+          break;
+        }
+
+        case slr::ActionType::ACCEPT:
+          row.action = "Accept";
+          break;
+
+        case slr::ActionType::ERROR:
+        default:
+          row.action = "Error";
+          break;
+      }
+      rows.push_back(std::move(row));
+    }
+    return rows;
+  }
+
+public:
+  // Starts a new trace of the given input
+  void start(std::string_view source) {
+    input.assign(source);
+    if (input.empty() || input.back() != '$') input += '$';
+    steps.clear();
+  }
+
+  void record(slr::Action action) {
+    steps.push_back(action);
+  }
+
+  std::size_t size() const {
+    return steps.size();
+  }
+
+  // Prints the step table, replaying the trace to rebuild it
+  void print(std::ostream &out) const {
+    std::vector<Row> rows = replay();
+
+    std::size_t stackWidth = 5, inputWidth = 5, actionWidth = 6;
+    for (const Row &row : rows) {
+      stackWidth  = std::max(stackWidth,  row.stack.size());
+      inputWidth  = std::max(inputWidth,  row.remaining.size());
+      actionWidth = std::max(actionWidth, row.action.size());
+    }
+
+    out << std::setw(5) << "Step" << "  " << std::left << std::setw(stackWidth) << "Stack" << "  " << std::right << std::setw(inputWidth) << "Input"
+        << "  " << std::left << "Action" << std::right << '\n';
+    out << std::string(5 + 2 + stackWidth + 2 + inputWidth + 2 + actionWidth, '-') << '\n';
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+      out << std::setw(5) << i + 1 << "  " << std::left << std::setw(stackWidth) << rows[i].stack << "  " << std::right << std::setw(inputWidth) << rows[i].remaining
+          << "  " << rows[i].action << '\n';
+    }
+    out << std::flush;
+  }
+};
+
+#endif
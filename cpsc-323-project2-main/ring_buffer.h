@@ -0,0 +1,65 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// A fixed ring of slots passed from one producer thread to one consumer thread.
+//
+// The producer fills the slot reserve() gives it and publishes it; the consumer reads the slot front() gives it and pops it.  The
+// slots themselves stay put and are refilled in turn, so a slot that owns memory (a vector, say) keeps it from one lap to the next.
+// Each side writes only its own counter, and waits on the other's when the ring is full or empty.  Either side may close the
+// ring, after which neither gets another slot, so one side stopping early can't leave the other waiting.
+template <typename T, std::size_t Capacity>
+class RingBuffer {
+private:
+  std::array<T, Capacity>   slots;
+  std::atomic<std::size_t>  published = 0;   // slots filled so far, counted by the producer
+  std::atomic<std::size_t>  popped    = 0;   // slots emptied so far, counted by the consumer
+  std::atomic<bool>         closed    = false;
+
+public:
+  // The slot to fill next, once there is a free one, or nullptr if the ring has been closed
+  T *reserve() {
+    std::size_t filled = published.load(std::memory_order_relaxed);
+    for (std::size_t emptied = popped.load(std::memory_order_acquire); filled - emptied == Capacity; emptied = popped.load(std::memory_order_acquire)) {
+      if (closed) return nullptr;
+      popped.wait(emptied, std::memory_order_acquire);
+    }
+    return closed ? nullptr : &slots[filled % Capacity];
+  }
+
+  // Hands the slot from reserve() to the consumer
+  void publish() {
+    published.fetch_add(1, std::memory_order_release);
+    published.notify_one();
+  }
+
+  // The oldest published slot, once there is one, or nullptr if the ring has been closed
+  T *front() {
+    std::size_t emptied = popped.load(std::memory_order_relaxed);
+    for (std::size_t filled = published.load(std::memory_order_acquire); filled == emptied; filled = published.load(std::memory_order_acquire)) {
+      if (closed) return nullptr;
+      published.wait(filled, std::memory_order_acquire);
+    }
+    return closed ? nullptr : &slots[emptied % Capacity];
+  }
+
+  // Hands the slot from front() back to the producer
+  void pop() {
+    popped.fetch_add(1, std::memory_order_release);
+    popped.notify_one();
+  }
+
+  // Stops both sides.  Both counters are moved so that whichever side is waiting wakes and sees the ring closed.
+  void close() {
+    closed = true;
+    published.fetch_add(1);
+    published.notify_all();
+    popped.fetch_add(1);
+    popped.notify_all();
+  }
+};
+
+#endif
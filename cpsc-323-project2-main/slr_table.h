@@ -0,0 +1,87 @@
+#ifndef SLR_TABLE_H
+#define SLR_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "lr_generator.h"
+
+// The SLR(1) parsing table for the expression grammar
+//
+//   1. E -> E + T      2. E -> T
+//   3. T -> T * F      4. T -> F
+//   5. F -> ( E )      6. F -> i
+//
+// ACTION is indexed by state and terminal, GOTO by state and nonterminal, so each step of the parse is one table lookup.  The
+// tables are generated from the grammar while compiling (see lr_generator.h), and come out as the textbook has them:
+//
+//          i      +      *      (      )      $         E   T   F
+//     0 {  s5                   s4                  }   1   2   3
+//     1 {         s6                          acc   }
+//     2 {         r2     s7            r2     r2    }
+//     3 {         r4     r4            r4     r4    }
+//     4 {  s5                   s4                  }   8   2   3
+//     5 {         r6     r6            r6     r6    }
+//     6 {  s5                   s4                  }       9   3
+//     7 {  s5                   s4                  }          10
+//     8 {         s6                   s11          }
+//     9 {         r1     s7            r1     r1    }
+//    10 {         r3     r3            r3     r3    }
+//    11 {         r5     r5            r5     r5    }
+namespace slr {
+
+using lr::Action;
+using lr::ActionType;
+using lr::s;
+using lr::r;
+using lr::acc;
+using lr::err;
+
+enum Terminal : std::uint8_t { ID, PLUS, TIMES, LPAREN, RPAREN, END, TERMINAL_COUNT };
+enum NonTerminal : std::uint8_t { E, T, F, NONTERMINAL_COUNT };
+
+// The terminal for an input character, or TERMINAL_COUNT if the character isn't one.  A digit is an operand like i, one with a value.
+constexpr Terminal toTerminal(char c) {
+  if (c >= '0' && c <= '9') return ID;
+  switch (c) {
+    case 'i': return ID;
+    case '+': return PLUS;
+    case '*': return TIMES;
+    case '(': return LPAREN;
+    case ')': return RPAREN;
+    case '$': return END;
+    default:  return TERMINAL_COUNT;
+  }
+}
+
+// Indexed by rule number; rule 0 is the augmented start rule E' -> E, which the table accepts on rather than reduces
+constexpr lr::Grammar<Terminal, NonTerminal, 7> grammar = {
+  {"i", "+", "*", "(", ")", "$"},
+  {"E", "T", "F"},
+  END,
+  {{
+    {E, E},
+    {E, E, PLUS, T},
+    {E, T},
+    {T, T, TIMES, F},
+    {T, F},
+    {F, LPAREN, E, RPAREN},
+    {F, ID},
+  }},
+};
+
+constexpr const auto &productions = grammar.rules;
+
+constexpr std::size_t STATE_COUNT = lr::stateCount(grammar);
+
+constexpr auto tables = lr::makeTables<STATE_COUNT>(grammar);
+
+constexpr const auto &actionTable = tables.actionTable;
+constexpr const auto &gotoTable   = tables.gotoTable;
+
+using Recognizer = lr::Recognizer<std::remove_const_t<decltype(grammar)>, STATE_COUNT>;
+
+}  // namespace slr
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef STATEMENT_GRAMMAR_H
+#define STATEMENT_GRAMMAR_H
+
+#include <cstddef>
+#include <cstdint>
+#include "lr_generator.h"
+
+// A small statement language, a larger grammar for the generator than the expression grammar
+//
+//    1. Program   -> List                                     13. Condition  -> Expression == Expression
+//    2. List      -> List Statement                           14. Expression -> Expression + Term
+//    3. List      -> Statement                                15. Expression -> Expression - Term
+//    4. Statement -> id = Expression ;                        16. Expression -> Term
+//    5. Statement -> print Expression ;                       17. Term       -> Term * Factor
+//    6. Statement -> if ( Condition ) Block                   18. Term       -> Term / Factor
+//    7. Statement -> if ( Condition ) Block else Block        19. Term       -> Factor
+//    8. Statement -> while ( Condition ) Block                20. Factor     -> ( Expression )
+//    9. Statement -> Block                                    21. Factor     -> id
+//   10. Block     -> { List }                                 22. Factor     -> num
+//   11. Block     -> { }                                      23. Factor     -> - Factor
+//   12. Condition -> Expression < Expression
+//
+// The branches of an if are always blocks, so an else can only belong to one if and the grammar is SLR(1).
+namespace statements {
+
+enum Terminal : std::uint8_t {
+  ID, NUM, ASSIGN, SEMICOLON, PLUS, MINUS, TIMES, DIVIDE, LPAREN, RPAREN, LESS, EQUAL, IF, ELSE, WHILE, PRINT, LBRACE, RBRACE, END,
+  TERMINAL_COUNT
+};
+
+enum NonTerminal : std::uint8_t { PROGRAM, LIST, STATEMENT, BLOCK, CONDITION, EXPRESSION, TERM, FACTOR, NONTERMINAL_COUNT };
+
+constexpr lr::Grammar<Terminal, NonTerminal, 24> grammar = {
+  {"id", "num", "=", ";", "+", "-", "*", "/", "(", ")", "<", "==", "if", "else", "while", "print", "{", "}", "$"},
+  {"Program", "List", "Statement", "Block", "Condition", "Expression", "Term", "Factor"},
+  END,
+  {{
+    {PROGRAM, PROGRAM},
+    {PROGRAM, LIST},
+    {LIST, LIST, STATEMENT},
+    {LIST, STATEMENT},
+    {STATEMENT, ID, ASSIGN, EXPRESSION, SEMICOLON},
+    {STATEMENT, PRINT, EXPRESSION, SEMICOLON},
+    {STATEMENT, IF, LPAREN, CONDITION, RPAREN, BLOCK},
+    {STATEMENT, IF, LPAREN, CONDITION, RPAREN, BLOCK, ELSE, BLOCK},
+    {STATEMENT, WHILE, LPAREN, CONDITION, RPAREN, BLOCK},
+    {STATEMENT, BLOCK},
+    {BLOCK, LBRACE, LIST, RBRACE},
+    {BLOCK, LBRACE, RBRACE},
+    {CONDITION, EXPRESSION, LESS, EXPRESSION},
+    {CONDITION, EXPRESSION, EQUAL, EXPRESSION},
+    {EXPRESSION, EXPRESSION, PLUS, TERM},
+    {EXPRESSION, EXPRESSION, MINUS, TERM},
+    {EXPRESSION, TERM},
+    {TERM, TERM, TIMES, FACTOR},
+    {TERM, TERM, DIVIDE, FACTOR},
+    {TERM, FACTOR},
+    {FACTOR, LPAREN, EXPRESSION, RPAREN},
+    {FACTOR, ID},
+    {FACTOR, NUM},
+    {FACTOR, MINUS, FACTOR},
+  }},
+};
+
+constexpr std::size_t STATE_COUNT = lr::stateCount(grammar);
+
+constexpr auto tables = lr::makeTables<STATE_COUNT>(grammar);
+
+}  // namespace statements
+
+#endif
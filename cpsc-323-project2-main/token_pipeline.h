@@ -0,0 +1,146 @@
+#ifndef TOKEN_PIPELINE_H
+#define TOKEN_PIPELINE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+#include "../The_Lexer-main/The_Lexer-main/lexer.h"
+#include "lr_generator.h"
+#include "ring_buffer.h"
+#include "slr_table.h"
+
+// Parsing source text straight from the lexer's tokens, with no text in between.
+//
+// Each token is turned into a grammar terminal as it comes out of the lexer and pushed into the parser.  parse() does both in one
+// loop.  parseThreaded() runs the lexer on a thread of its own, which sends terminals to the parser on the calling thread in
+// batches through a ring buffer, so the two sides only meet once a batch.
+//
+// tokens is anything with the lexer's bool next(Token&), a Lexer over text in memory or a TokenStream over a file.
+namespace pipeline {
+
+using Parser = slr::Recognizer;
+
+// The grammar terminal for a token, or TERMINAL_COUNT for a token the grammar has no place for.  Identifiers and constants are
+// both operands, i.  A $ ends the input early, as it does in the parser's own strings.
+constexpr slr::Terminal toTerminal(const Token &token) {
+  switch (token.kind) {
+    case TokenKind::Identifier:
+    case TokenKind::Constant:
+      return slr::ID;
+
+    case TokenKind::Operator:
+    case TokenKind::Symbol:
+    case TokenKind::Unknown:
+      return token.lexeme.size() == 1 ? slr::toTerminal(token.lexeme[0]) : slr::TERMINAL_COUNT;
+
+    case TokenKind::Keyword:   // the expression grammar has no keywords
+    default:
+      return slr::TERMINAL_COUNT;
+  }
+}
+
+struct Result {
+  bool            accepted = false;
+  std::size_t     tokens   = 0;   // how many tokens the parser took, up to the one it stopped on
+  SourcePosition  position;       // where that token starts; for input that ends too soon, the last token
+};
+
+constexpr std::size_t defaultBatchSize = 4096;
+
+namespace detail {
+
+// Passes one token's terminal to the parser.  After the end marker the parser rejects whatever comes next, so feeding can go on
+// until the parser rejects or the tokens run out.
+inline Parser::Status feed(Parser &parser, Result &result, lr::Symbol terminal, SourcePosition position) {
+  ++result.tokens;
+  result.position = position;
+  Parser::Status status = parser.push(terminal);
+  result.accepted = status == Parser::Status::ACCEPTED;
+  return status;
+}
+
+// Ends the input, pushing the end marker if the tokens left it off
+inline void finish(Parser &parser, Result &result, Parser::Status status) {
+  if (status == Parser::Status::READING) result.accepted = parser.push(slr::END) == Parser::Status::ACCEPTED;
+}
+
+struct Batch {
+  std::vector<lr::Symbol>      terminals;
+  std::vector<SourcePosition>  positions;
+  bool                         last = false;   // nothing follows this batch
+};
+
+}  // namespace detail
+
+// Lexes and parses on the calling thread, a token at a time
+template <typename Tokens>
+Result parse(Tokens &tokens) {
+  Parser          parser(slr::grammar, slr::tables);
+  Result          result;
+  Parser::Status  status = Parser::Status::READING;
+  Token           token;
+  while (tokens.next(token)) {
+    status = detail::feed(parser, result, toTerminal(token), token.position);
+    if (status == Parser::Status::REJECTED) return result;
+  }
+  detail::finish(parser, result, status);
+  return result;
+}
+
+// Lexes on a thread of its own while the calling thread parses.  The lexer stops as soon as the parser rejects.
+template <typename Tokens>
+Result parseThreaded(Tokens &tokens, std::size_t batchSize = defaultBatchSize) {
+  batchSize = std::max<std::size_t>(batchSize, 1);
+
+  RingBuffer<detail::Batch, 8>  ring;
+  std::exception_ptr            failure;
+
+  std::jthread lexer([&] {
+    try {
+      Token token;
+      for (bool more = true; more;) {
+        detail::Batch *batch = ring.reserve();
+        if (batch == nullptr) return;   // the parser is done
+
+        batch->terminals.clear();
+        batch->positions.clear();
+        while (batch->terminals.size() < batchSize && (more = tokens.next(token))) {
+          batch->terminals.push_back(toTerminal(token));
+          batch->positions.push_back(token.position);
+        }
+        batch->last = !more;
+        ring.publish();
+      }
+    }
+    catch (...) {
+      failure = std::current_exception();
+      ring.close();
+    }
+  });
+
+  Parser          parser(slr::grammar, slr::tables);
+  Result          result;
+  Parser::Status  status = Parser::Status::READING;
+  for (bool more = true; more;) {
+    detail::Batch *batch = ring.front();
+    if (batch == nullptr) break;   // the lexer failed
+
+    for (std::size_t i = 0; i < batch->terminals.size() && status != Parser::Status::REJECTED; ++i) {
+      status = detail::feed(parser, result, batch->terminals[i], batch->positions[i]);
+    }
+    if (batch->last) detail::finish(parser, result, status);
+    more = !batch->last && status != Parser::Status::REJECTED;
+    ring.pop();
+  }
+  ring.close();
+  lexer.join();
+
+  if (failure) std::rethrow_exception(failure);
+  return result;
+}
+
+}  // namespace pipeline
+
+#endif